@@ -0,0 +1,114 @@
+#include <stdatomic.h>
+#include <time.h>
+
+#include "aleatorio.h"
+
+//cada hilo tiene su propio estado: no hay que sincronizar y las secuencias no se mezclan
+static _Thread_local struct Aleatorio generadorHilo;
+static _Thread_local int generadorSembrado = 0;
+
+//numera los hilos que usan el generador sin sembrarlo, para que no repitan la misma secuencia
+static atomic_uint_fast64_t hilosSinSemilla = 0;
+
+/*
+E: puntero al estado de splitmix64.
+S: siguiente numero de splitmix64; sirve para expandir una semilla de 64 bits a 256 bits.
+R: ninguna.
+*/
+static uint64_t splitmix64(uint64_t* estado) {
+    uint64_t z = (*estado += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/*
+E: generador y semilla (cualquier valor, incluso 0).
+S: deja el estado listo; la misma semilla repite la misma secuencia.
+R: gen no NULL.
+*/
+void sembrarAleatorio(struct Aleatorio* gen, uint64_t semilla) {
+    //splitmix64 nunca deja los 4 valores en 0 (estado prohibido de xoshiro)
+    for (int i = 0; i < 4; ++i) {
+        gen->s[i] = splitmix64(&semilla);
+    }
+}
+
+/*
+E: generador y cantidad de valores n.
+S: entero uniforme en [0, n-1] (0 si n es 0).
+R: gen sembrado; metodo de Lemire: una multiplicacion y rechazo solo en el sesgo.
+*/
+uint32_t aleatorioRango(struct Aleatorio* gen, uint32_t n) {
+    if (n == 0) {
+        return 0;
+    }
+    uint64_t m = (siguienteAleatorio(gen) >> 32) * n;
+    uint32_t bajo = (uint32_t)m;
+    if (bajo < n) {
+        uint32_t limite = (uint32_t)(-n) % n;
+        while (bajo < limite) {
+            m = (siguienteAleatorio(gen) >> 32) * n;
+            bajo = (uint32_t)m;
+        }
+    }
+    return (uint32_t)(m >> 32);
+}
+
+/*
+E: generador.
+S: real uniforme en [0, 1) con 53 bits de precision.
+R: gen sembrado.
+*/
+double aleatorioReal(struct Aleatorio* gen) {
+    return (double)(siguienteAleatorio(gen) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+/*
+E: probabilidad (se ajusta a [0, 1]).
+S: umbral para aleatorioBernoulli: 0 nunca acepta, 2^53 siempre acepta.
+R: ninguna; se calcula una vez fuera del ciclo que lanza las monedas.
+*/
+uint64_t umbralProbabilidad(double probabilidad) {
+    if (probabilidad <= 0.0) {
+        return 0;
+    }
+    if (probabilidad >= 1.0) {
+        return 1ULL << 53;
+    }
+    return (uint64_t)(probabilidad * 9007199254740992.0);
+}
+
+/*
+E: ninguna.
+S: generador del hilo que llama; si el hilo no lo sembro, se siembra con un numero de hilo distinto.
+R: el puntero solo es valido en el hilo que lo pidio.
+*/
+struct Aleatorio* aleatorioHilo(void) {
+    if (!generadorSembrado) {
+        sembrarAleatorio(&generadorHilo, atomic_fetch_add(&hilosSinSemilla, 1));
+        generadorSembrado = 1;
+    }
+    return &generadorHilo;
+}
+
+/*
+E: semilla.
+S: siembra el generador del hilo que llama (los demas hilos no cambian).
+R: ninguna.
+*/
+void sembrarAleatorioHilo(uint64_t semilla) {
+    sembrarAleatorio(&generadorHilo, semilla);
+    generadorSembrado = 1;
+}
+
+/*
+E: ninguna.
+S: semilla tomada del reloj (segundos y nanosegundos) para corridas no repetibles.
+R: ninguna.
+*/
+uint64_t semillaDeReloj(void) {
+    struct timespec ahora;
+    timespec_get(&ahora, TIME_UTC);
+    return (uint64_t)ahora.tv_sec * 1000000000ULL + (uint64_t)ahora.tv_nsec;
+}
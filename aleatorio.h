@@ -0,0 +1,42 @@
+#ifndef ALEATORIO_H
+#define ALEATORIO_H
+
+#include <stdint.h>
+
+//generador xoshiro256** (Blackman y Vigna): 256 bits de estado, periodo 2^256 - 1
+//la misma semilla produce la misma secuencia en cualquier plataforma (a diferencia de rand())
+struct Aleatorio {
+    uint64_t s[4];
+};
+
+// funciones del generador
+void sembrarAleatorio(struct Aleatorio* gen, uint64_t semilla);
+uint32_t aleatorioRango(struct Aleatorio* gen, uint32_t n);
+double aleatorioReal(struct Aleatorio* gen);
+uint64_t umbralProbabilidad(double probabilidad);
+struct Aleatorio* aleatorioHilo(void);
+void sembrarAleatorioHilo(uint64_t semilla);
+uint64_t semillaDeReloj(void);
+
+//siguiente numero de 64 bits; en el encabezado para que los ciclos que generan
+//millones de numeros no paguen una llamada por cada uno
+static inline uint64_t siguienteAleatorio(struct Aleatorio* gen) {
+    uint64_t* s = gen->s;
+    uint64_t x = s[1] * 5;
+    uint64_t resultado = ((x << 7) | (x >> 57)) * 9;
+    uint64_t t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = (s[3] << 45) | (s[3] >> 19);
+    return resultado;
+}
+
+//1 con la probabilidad codificada en umbral (ver umbralProbabilidad), sin pasar por double
+static inline int aleatorioBernoulli(struct Aleatorio* gen, uint64_t umbral) {
+    return (siguienteAleatorio(gen) >> 11) < umbral;
+}
+
+#endif
@@ -0,0 +1,249 @@
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "alt.h"
+#include "reloj.h"
+
+/*
+E: oraculo, vertice v y meta t.
+S: retorna la mayor cota inferior de d(v, t) entre todos los landmarks (heuristica admisible y consistente).
+R: indices validos; landmarks que no alcanzan a ambos vertices no aportan.
+*/
+static int heuristicaALT(const struct OraculoALT* oraculo, int v, int t) {
+    const int* dv = &oraculo->dist[(size_t)v * oraculo->k];
+    const int* dt = &oraculo->dist[(size_t)t * oraculo->k];
+    int h = 0;
+    for (int l = 0; l < oraculo->k; ++l) {
+        if (dv[l] < 0 || dt[l] < 0) {
+            continue;
+        }
+        //sin simetria d(v,l) es desconocida y solo vale d(l,t) - d(l,v)
+        int diferencia = (dv[l] > dt[l] && oraculo->simetrico) ? dv[l] - dt[l] : dt[l] - dv[l];
+        if (diferencia > h) {
+            h = diferencia;
+        }
+    }
+    return h;
+}
+
+/*
+E: grafo no dirigido con pesos no negativos, cantidad de landmarks deseada y vertice de referencia
+   (por ejemplo el inicio del laberinto) dentro de la zona que se va a consultar.
+S: puntero a oraculo con las distancias de cada landmark a todos los vertices, o NULL en error.
+R: memoria para k * vertices enteros; k se ajusta a [1, min(vertices, 64)].
+*/
+struct OraculoALT* crearOraculoALT(const struct Grafo* grafo, int k, int referencia) {
+    if (grafo == NULL || grafo->vertices <= 0 || !grafo->pesosNoNegativos) {
+        return NULL;
+    }
+    if (referencia < 0 || referencia >= grafo->vertices) {
+        referencia = 0;
+    }
+    int n = grafo->vertices;
+    if (k < 1) {
+        k = 1;
+    }
+    if (k > 64) {
+        k = 64;
+    }
+    if (k > n) {
+        k = n;
+    }
+
+    struct timespec antes;
+    timespec_get(&antes, TIME_UTC);
+
+    struct OraculoALT* oraculo = calloc(1, sizeof(struct OraculoALT));
+    int* tmp = malloc((size_t)n * sizeof(int));
+    int* minimo = malloc((size_t)n * sizeof(int));
+    struct EspacioBusqueda* espacio = crearEspacioBusqueda(n);
+    if (oraculo != NULL) {
+        oraculo->landmarks = malloc((size_t)k * sizeof(int));
+        oraculo->dist = malloc((size_t)n * k * sizeof(int));
+    }
+    if (oraculo == NULL || oraculo->landmarks == NULL || oraculo->dist == NULL || tmp == NULL || minimo == NULL || espacio == NULL) {
+        liberarOraculoALT(oraculo);
+        free(tmp);
+        free(minimo);
+        liberarEspacioBusqueda(espacio);
+        return NULL;
+    }
+    oraculo->k = k;
+    oraculo->vertices = n;
+    oraculo->simetrico = grafo->pesosSimetricos;
+
+    //seleccion por el punto mas lejano: el primer landmark es el vertice mas lejano a la referencia,
+    //y cada siguiente es el alcanzable mas lejano a todos los ya elegidos
+    //(los bolsillos aislados no reciben landmarks; ahi la heuristica vale 0)
+    dijkstraDistancias(grafo, referencia, tmp, espacio);
+    int siguiente = referencia;
+    for (int v = 0; v < n; ++v) {
+        if (tmp[v] > tmp[siguiente]) {
+            siguiente = v;
+        }
+        minimo[v] = INT_MAX;
+    }
+
+    for (int l = 0; l < k; ++l) {
+        oraculo->landmarks[l] = siguiente;
+        dijkstraDistancias(grafo, siguiente, tmp, espacio);
+
+        int mejor = -1;
+        for (int v = 0; v < n; ++v) {
+            oraculo->dist[(size_t)v * k + l] = tmp[v];
+            if (tmp[v] >= 0 && tmp[v] < minimo[v]) {
+                minimo[v] = tmp[v];
+            }
+            if (minimo[v] != INT_MAX && (mejor == -1 || minimo[v] > minimo[mejor])) {
+                mejor = v;
+            }
+        }
+        siguiente = mejor;
+    }
+
+    free(tmp);
+    free(minimo);
+    liberarEspacioBusqueda(espacio);
+
+    oraculo->segundosPreproceso = segundosDesde(&antes);
+    oraculo->bytes = (size_t)n * k * sizeof(int) + (size_t)k * sizeof(int);
+    return oraculo;
+}
+
+/*
+E: oraculo, dos vertices y punteros para las cotas.
+S: 0 si hay cotas (inferior <= d(a,b) <= superior), -1 si a y b estan en componentes distintas,
+   1 si ningun landmark alcanza a ambos (inferior = 0, superior = -1 = desconocida);
+   con pesos no simetricos superior queda en -1.
+R: indices dentro de [0, vertices-1]; costo O(k).
+*/
+int cotasALT(const struct OraculoALT* oraculo, int a, int b, int* inferior, int* superior) {
+    *inferior = 0;
+    *superior = -1;
+    if (oraculo == NULL || a < 0 || b < 0 || a >= oraculo->vertices || b >= oraculo->vertices) {
+        return 1;
+    }
+
+    const int* da = &oraculo->dist[(size_t)a * oraculo->k];
+    const int* db = &oraculo->dist[(size_t)b * oraculo->k];
+    int alguno = 0;
+    for (int l = 0; l < oraculo->k; ++l) {
+        if (da[l] < 0 && db[l] < 0) {
+            continue;
+        }
+        if (da[l] < 0 || db[l] < 0) {
+            return -1; //un landmark alcanza a uno y no al otro: no hay camino entre ellos
+        }
+        alguno = 1;
+        int diferencia = (da[l] > db[l] && oraculo->simetrico) ? da[l] - db[l] : db[l] - da[l];
+        if (diferencia > *inferior) {
+            *inferior = diferencia;
+        }
+        if (oraculo->simetrico && (*superior == -1 || da[l] + db[l] < *superior)) {
+            *superior = da[l] + db[l];
+        }
+    }
+    return alguno ? 0 : 1;
+}
+
+/*
+Calcula el camino mas corto con A* usando la heuristica de landmarks.
+E: grafo con el que se construyo el oraculo, oraculo, indices inicio y fin, espacio de busqueda.
+S: retorna puntero a Camino minimo (mismo valor que dijkstra) o NULL si no hay ruta/error;
+   espacio->parent conserva el arbol de la consulta.
+R: el grafo no cambio desde crearOraculoALT; espacio con capacidad >= vertices.
+*/
+struct Camino* caminoALT(const struct Grafo* grafo, const struct OraculoALT* oraculo, int inicio, int fin, struct EspacioBusqueda* espacio) {
+    if (grafo == NULL || oraculo == NULL || espacio == NULL || oraculo->vertices != grafo->vertices || espacio->capacidad < grafo->vertices) {
+        return NULL;
+    }
+    int n = grafo->vertices;
+    if (inicio < 0 || fin < 0 || inicio >= n || fin >= n) {
+        return NULL;
+    }
+
+    //las etiquetas del grafo (O(1)) o los landmarks (O(k)) descartan las consultas entre componentes distintas
+    if (mismaComponente(grafo, inicio, fin) == 0) {
+        return NULL;
+    }
+    int inferior;
+    int superior;
+    if (cotasALT(oraculo, inicio, fin, &inferior, &superior) == -1) {
+        return NULL;
+    }
+
+    struct ColaPrioridad* cola = colaDeEspacio(espacio, COLA_HEAP_BINARIO, 1);
+    if (cola == NULL) {
+        return NULL;
+    }
+    cola->traza = NULL;
+    nuevaConsulta(espacio);
+    espacioAsignarValor(espacio, inicio, 0);
+    espacio->parent[inicio] = -1;
+
+    //la prioridad en la cola es f = g + h
+    insertarCola(cola, inicio, heuristicaALT(oraculo, inicio, fin));
+
+    int expandidos = 0;
+    while (cola->tamano > 0) {
+        struct NodoPrioridad actual = extraerMinimo(cola);
+        int v = actual.vertice;
+        if (v == -1) {
+            break;
+        }
+
+        //con heuristica consistente cada vertice se expande una sola vez
+        if (espacioVisitado(espacio, v)) {
+            continue;
+        }
+        espacioMarcarVisitado(espacio, v);
+        expandidos++;
+
+        //al extraer la meta su valor ya es minimo
+        if (v == fin) {
+            break;
+        }
+
+        int valV = espacio->val[v];
+        for (int e = grafo->offsets[v]; e < grafo->offsets[v + 1]; ++e) {
+            int u = grafo->vecinos[e];
+            int peso = grafo->pesos[e];
+            if (peso <= 0 || espacioVisitado(espacio, u)) {
+                continue;
+            }
+
+            int nuevoVal = valV + peso;
+            if (!espacioTieneValor(espacio, u) || nuevoVal < espacio->val[u]) {
+                espacioAsignarValor(espacio, u, nuevoVal);
+                espacio->parent[u] = v;
+                insertarCola(cola, u, nuevoVal + heuristicaALT(oraculo, u, fin));
+            }
+        }
+    }
+
+    //reconstruir el camino si se encontro una ruta valida
+    struct Camino* camino = NULL;
+    if (espacioVisitado(espacio, fin)) {
+        camino = reconstruirCamino(espacio->parent, inicio, fin, espacio->val[fin], n);
+        if (camino != NULL) {
+            camino->expandidos = expandidos;
+        }
+    }
+    return camino;
+}
+
+/*
+E: oraculo previamente creado.
+S: libera las tablas y la estructura.
+R: oraculo puede ser NULL, no usar despues.
+*/
+void liberarOraculoALT(struct OraculoALT* oraculo) {
+    if (oraculo == NULL) {
+        return;
+    }
+    free(oraculo->landmarks);
+    free(oraculo->dist);
+    free(oraculo);
+}
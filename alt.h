@@ -0,0 +1,29 @@
+#ifndef ALT_H
+#define ALT_H
+
+#include <stddef.h>
+
+#include "grafo.h"
+#include "dijkstra.h"
+
+//oraculo ALT (A*, Landmarks, desigualdad Triangular) para consultas repetidas sobre un grafo fijo
+//guarda la distancia exacta de k landmarks a cada vertice; por la desigualdad triangular
+//|d(l,a) - d(l,b)| <= d(a,b) <= d(a,l) + d(l,b) para cualquier landmark l
+//con pesos no simetricos (terreno) solo queda d(l,b) - d(l,a) <= d(a,b)
+struct OraculoALT {
+    int k; //cantidad de landmarks
+    int vertices; //vertices del grafo con el que se construyo
+    int simetrico; //1 si el grafo tenia pesos simetricos (d(l,v) = d(v,l))
+    int* landmarks; //vertice de cada landmark
+    int* dist; //dist[v * k + l] = distancia del landmark l a v (-1 = inalcanzable)
+    double segundosPreproceso; //tiempo que tomo construirlo
+    size_t bytes; //memoria usada por las tablas
+};
+
+// funciones del oraculo ALT
+struct OraculoALT* crearOraculoALT(const struct Grafo* grafo, int k, int referencia);
+int cotasALT(const struct OraculoALT* oraculo, int a, int b, int* inferior, int* superior);
+struct Camino* caminoALT(const struct Grafo* grafo, const struct OraculoALT* oraculo, int inicio, int fin, struct EspacioBusqueda* espacio);
+void liberarOraculoALT(struct OraculoALT* oraculo);
+
+#endif
@@ -0,0 +1,101 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "astar.h"
+
+/*
+Calcula el camino mas corto entre dos nodos usando A* con heuristica Manhattan.
+E: grafo con pesos no negativos e indexToCoord lleno, indices inicio y fin validos, espacio de busqueda.
+S: retorna puntero a Camino minimo (mismo valor que dijkstra) o NULL si no hay ruta/error;
+   espacio->parent conserva el arbol de la consulta.
+R: memoria disponible; pesos >=0; espacio con capacidad >= vertices.
+*/
+struct Camino* astar(struct Grafo* grafo, int inicio, int fin, struct EspacioBusqueda* espacio) {
+    //validar restricciones basicas
+    if (grafo == NULL || espacio == NULL || grafo->vertices <= 0 || grafo->offsets == NULL || grafo->indexToCoord == NULL ||
+        espacio->capacidad < grafo->vertices) {
+        return NULL;
+    }
+    int n = grafo->vertices;
+    if (inicio < 0 || fin < 0 || inicio >= n || fin >= n) {
+        return NULL;
+    }
+
+    //validar que los pesos sean no negativos (invariante del grafo, O(1))
+    if (!grafo->pesosNoNegativos) {
+        return NULL; //pesos negativos no permitidos
+    }
+    if (mismaComponente(grafo, inicio, fin) == 0) {
+        return NULL; //componentes distintas: no hay ruta
+    }
+
+    //cada arista avanza a lo sumo pasoCoordenadas en Manhattan y cuesta al menos pesoMinimo,
+    //asi h = Manhattan * pesoMinimo / pasoCoordenadas es admisible (invariantes del grafo, O(1))
+    int pesoMinimo = grafo->pesoMinimo;
+    int pasoMaximo = (grafo->pasoCoordenadas > 0) ? grafo->pasoCoordenadas : 1;
+    struct Point meta = grafo->indexToCoord[fin];
+
+    //reutilizar la cola y los arreglos del espacio en lugar de reservarlos por consulta
+    struct ColaPrioridad* cola = colaDeEspacio(espacio, COLA_HEAP_BINARIO, 1);
+    if (cola == NULL) {
+        return NULL;
+    }
+    cola->traza = NULL;
+    nuevaConsulta(espacio);
+    espacioAsignarValor(espacio, inicio, 0);
+    espacio->parent[inicio] = -1;
+
+    //la prioridad en la cola es f = g + h
+    struct Point p = grafo->indexToCoord[inicio];
+    insertarCola(cola, inicio, (abs(p.row - meta.row) + abs(p.col - meta.col)) * pesoMinimo / pasoMaximo);
+
+    int expandidos = 0;
+    while (cola->tamano > 0) {
+        struct NodoPrioridad actual = extraerMinimo(cola);
+        int v = actual.vertice;
+        if (v == -1) {
+            break;
+        }
+
+        //con heuristica consistente cada vertice se expande una sola vez
+        if (espacioVisitado(espacio, v)) {
+            continue;
+        }
+        espacioMarcarVisitado(espacio, v);
+        expandidos++;
+
+        //al extraer la meta su valor ya es minimo
+        if (v == fin) {
+            break;
+        }
+
+        int valV = espacio->val[v];
+        for (int e = grafo->offsets[v]; e < grafo->offsets[v + 1]; ++e) {
+            int u = grafo->vecinos[e];
+            int peso = grafo->pesos[e];
+            if (peso <= 0 || espacioVisitado(espacio, u)) {
+                continue;
+            }
+
+            int nuevoVal = valV + peso;
+            if (!espacioTieneValor(espacio, u) || nuevoVal < espacio->val[u]) {
+                espacioAsignarValor(espacio, u, nuevoVal);
+                espacio->parent[u] = v;
+
+                struct Point q = grafo->indexToCoord[u];
+                int h = (abs(q.row - meta.row) + abs(q.col - meta.col)) * pesoMinimo / pasoMaximo;
+                insertarCola(cola, u, nuevoVal + h);
+            }
+        }
+    }
+
+    //reconstruir el camino si se encontro una ruta valida
+    struct Camino* camino = NULL;
+    if (espacioVisitado(espacio, fin)) {
+        camino = reconstruirCamino(espacio->parent, inicio, fin, espacio->val[fin], n);
+        if (camino != NULL) {
+            camino->expandidos = expandidos;
+        }
+    }
+    return camino;
+}
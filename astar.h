@@ -0,0 +1,10 @@
+#ifndef ASTAR_H
+#define ASTAR_H
+
+#include "grafo.h"
+#include "dijkstra.h"
+
+//busqueda A* guiada por la distancia Manhattan entre coordenadas de los vertices
+struct Camino* astar(struct Grafo* grafo, int inicio, int fin, struct EspacioBusqueda* espacio);
+
+#endif
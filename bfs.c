@@ -1,47 +1,34 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <stdatomic.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "bfs.h"
+#include "lote.h" //hilosDisponibles
 
-//algoritmo BFS para grafos con matriz 0/1 de adyacencia
+//algoritmo BFS para grafos con adyacencia comprimida (CSR)
 
 /*
-E: grafo, nodo inicio y meta, arreglos parent/visitOrder y contador.
-S: ejecuta BFS, llena parent y orden visitado, retorna 1 si encontro goal.
-R: arreglos de tamano vertices; indices validos; memoria disponible.
+E: grafo, nodo inicio y meta, espacio de busqueda con capacidad para los vertices del grafo.
+S: ejecuta BFS sin reservar memoria; deja padres y orden de visita en el espacio; retorna 1 si encontro goal.
+R: indices validos; goal = -1 recorre todo lo alcanzable; espacio->parent solo es valido para vertices visitados en esta consulta.
 */
-int bfs(const struct Grafo *graph, int start, int goal, int *parent, int *visitOrder, int *visitCount) {
-    //reservar memoria para el arreglo de visitados (1 = visitado, 0 = no visitado)
-    int *visited = calloc(graph->vertices, sizeof(int));
-    
-    //reservar memoria para la cola
-    int *queue = calloc(graph->vertices, sizeof(int));
-    
-    //indices para controlar la cola
+int bfs_espacio(const struct Grafo *graph, int start, int goal, struct EspacioBusqueda *espacio) {
+    //empezar una consulta nueva: todos los vertices quedan sin visitar en O(1)
+    nuevaConsulta(espacio);
+
+    //el arreglo de orden funciona tambien como cola: lo que ya salio es el orden de visita
+    int *queue = espacio->orden;
     int head = 0;
     int tail = 0;
 
-    //verificar que la asignacion de memoria fue exitosa
-    if (visited == NULL || queue == NULL) {
-        printf("No se pudo reservar memoria para BFS.\n");
-        free(visited);
-        free(queue);
-        return 0;
-    }
-
-    //inicializar el arreglo de padres en -1 (indica que no tienen padre)
-    for (int i = 0; i < graph->vertices; ++i) {
-        parent[i] = -1;
-    }
-
-    //agregar el nodo de inicio a la cola
+    //agregar el nodo de inicio a la cola y marcarlo como visitado
     queue[tail++] = start;
-    
-    //marcar el nodo de inicio como visitado
-    visited[start] = 1;
-    
-    //inicializar el contador de nodos visitados
-    *visitCount = 0;
+    espacioMarcarVisitado(espacio, start);
+    espacio->parent[start] = -1; //el inicio no tiene padre
 
     //mientras haya elementos en la cola
     while (head < tail) {
@@ -49,25 +36,25 @@ int bfs(const struct Grafo *graph, int start, int goal, int *parent, int *visitO
         int v = queue[head++];
         
         //registrar este nodo en el orden de visita
-        visitOrder[(*visitCount)++] = v;
+        espacio->cantidadOrden = head;
 
         //si encontramos el nodo meta, terminar
         if (v == goal) {
-            free(visited);
-            free(queue);
             return 1; //exito
         }
 
         //explorar todos los vecinos del nodo actual
-        //recorrer la fila v de la matriz de pesos
-        for (int u = 0; u < graph->vertices; ++u) {
-            //si hay una arista de v a u (peso > 0) y u no ha sido visitado
-            if (graph->peso[v][u] > 0 && !visited[u]) {
+        //recorrer solo la lista de adyacencia de v (costo proporcional a su grado)
+        for (int e = graph->offsets[v]; e < graph->offsets[v + 1]; ++e) {
+            int u = graph->vecinos[e];
+
+            //si la arista de v a u sigue activa (peso > 0) y u no ha sido visitado
+            if (graph->pesos[e] > 0 && !espacioVisitado(espacio, u)) {
                 //marcar el vecino como visitado
-                visited[u] = 1;
+                espacioMarcarVisitado(espacio, u);
                 
                 //registrar que llegamos a u desde v (para reconstruir el camino)
-                parent[u] = v;
+                espacio->parent[u] = v;
                 
                 //agregar el vecino a la cola para explorarlo despues
                 queue[tail++] = u;
@@ -76,7 +63,246 @@ int bfs(const struct Grafo *graph, int start, int goal, int *parent, int *visitO
     }
 
     //si llegamos aqui, no se encontro un camino al nodo meta
-    free(visited);
-    free(queue);
     return 0; //no se encontro camino
 }
+
+/*
+E: grafo, nodo inicio y meta, arreglos parent/visitOrder y contador.
+S: ejecuta BFS, llena parent y orden visitado, retorna 1 si encontro goal.
+R: arreglos de tamano vertices; indices validos; memoria disponible.
+*/
+int bfs(const struct Grafo *graph, int start, int goal, int *parent, int *visitOrder, int *visitCount) {
+    //espacio temporal; para consultas repetidas conviene reutilizar uno con bfs_espacio
+    struct EspacioBusqueda *espacio = crearEspacioBusqueda(graph->vertices);
+    if (espacio == NULL) {
+        printf("No se pudo reservar memoria para BFS.\n");
+        return 0;
+    }
+
+    int found = bfs_espacio(graph, start, goal, espacio);
+
+    //copiar los resultados a los arreglos del llamador (-1 = sin padre)
+    for (int i = 0; i < graph->vertices; ++i) {
+        parent[i] = espacioVisitado(espacio, i) ? espacio->parent[i] : -1;
+    }
+    for (int i = 0; i < espacio->cantidadOrden; ++i) {
+        visitOrder[i] = espacio->orden[i];
+    }
+    *visitCount = espacio->cantidadOrden;
+
+    liberarEspacioBusqueda(espacio);
+    return found;
+}
+
+//BFS paralelo por niveles: todos los hilos expanden la frontera actual y arman juntos la siguiente
+
+//vertices de la frontera que un hilo toma de una vez
+#define BFS_BLOQUE_FRONTERA 64
+//vertices que un hilo junta en su buffer local antes de copiarlos a la siguiente frontera
+#define BFS_BUFFER_LOCAL 1024
+
+//datos compartidos por los hilos del BFS paralelo (el grafo solo se lee)
+struct TrabajoBFS {
+    const struct Grafo *graph;
+    int goal;
+    int *parent;
+    int *dist;
+    atomic_uint *visitados; //un bit por vertice; se reclama con fetch_or
+    int *frontera; //vertices del nivel actual
+    int *siguiente; //vertices del siguiente nivel
+    int tamFrontera;
+    atomic_int tamSiguiente; //espacio ya reservado en siguiente
+    atomic_int tomados; //vertices de la frontera que ya tomo algun hilo
+    atomic_int encontrado; //1 si algun hilo reclamo la meta
+    int nivel; //distancia de los vertices de la frontera
+    int terminado; //lo escribe un solo hilo entre las dos barreras de cada nivel
+    pthread_barrier_t barrera; //sincroniza el fin de cada nivel
+    pthread_mutex_t candado; //protege la puerta de arranque
+    pthread_cond_t arranque;
+    int listo; //1 cuando la barrera ya esta inicializada
+};
+
+/*
+E: trabajo compartido y buffer local con su cantidad.
+S: copia el buffer al final de la siguiente frontera y lo deja vacio.
+R: la siguiente frontera tiene espacio para todos los vertices.
+*/
+static void vaciarBufferBFS(struct TrabajoBFS *trabajo, int *buffer, int *cantidad) {
+    if (*cantidad == 0) {
+        return;
+    }
+    int desde = atomic_fetch_add(&trabajo->tamSiguiente, *cantidad);
+    memcpy(&trabajo->siguiente[desde], buffer, (size_t)*cantidad * sizeof(int));
+    *cantidad = 0;
+}
+
+/*
+E: puntero a TrabajoBFS.
+S: expande bloques de cada frontera hasta que no quedan niveles o se alcanza la meta.
+R: todos los hilos pasan por las mismas barreras en cada nivel.
+*/
+static void *trabajadorBFS(void *arg) {
+    struct TrabajoBFS *trabajo = arg;
+    const struct Grafo *graph = trabajo->graph;
+    int buffer[BFS_BUFFER_LOCAL];
+    int cantidad = 0;
+
+    pthread_mutex_lock(&trabajo->candado);
+    while (!trabajo->listo) {
+        pthread_cond_wait(&trabajo->arranque, &trabajo->candado);
+    }
+    pthread_mutex_unlock(&trabajo->candado);
+
+    while (1) {
+        int nivelSiguiente = trabajo->nivel + 1;
+        while (1) {
+            int desde = atomic_fetch_add(&trabajo->tomados, BFS_BLOQUE_FRONTERA);
+            if (desde >= trabajo->tamFrontera) {
+                break;
+            }
+            int hasta = desde + BFS_BLOQUE_FRONTERA;
+            if (hasta > trabajo->tamFrontera) {
+                hasta = trabajo->tamFrontera;
+            }
+
+            for (int i = desde; i < hasta; ++i) {
+                int v = trabajo->frontera[i];
+                for (int e = graph->offsets[v]; e < graph->offsets[v + 1]; ++e) {
+                    int u = graph->vecinos[e];
+                    if (graph->pesos[e] <= 0) {
+                        continue;
+                    }
+
+                    //lectura previa sin sincronizar: si el bit ya esta, se evita la operacion atomica
+                    unsigned int bit = 1u << (u & 31);
+                    atomic_uint *palabra = &trabajo->visitados[u >> 5];
+                    if ((atomic_load_explicit(palabra, memory_order_relaxed) & bit) != 0) {
+                        continue;
+                    }
+                    if ((atomic_fetch_or_explicit(palabra, bit, memory_order_relaxed) & bit) != 0) {
+                        continue; //otro hilo lo reclamo primero
+                    }
+
+                    //solo el hilo que reclamo u escribe su padre y distancia
+                    trabajo->parent[u] = v;
+                    if (trabajo->dist != NULL) {
+                        trabajo->dist[u] = nivelSiguiente;
+                    }
+                    if (u == trabajo->goal) {
+                        atomic_store(&trabajo->encontrado, 1);
+                    }
+                    buffer[cantidad++] = u;
+                    if (cantidad == BFS_BUFFER_LOCAL) {
+                        vaciarBufferBFS(trabajo, buffer, &cantidad);
+                    }
+                }
+            }
+        }
+        vaciarBufferBFS(trabajo, buffer, &cantidad);
+
+        //un solo hilo cambia de nivel mientras los demas esperan en la segunda barrera
+        if (pthread_barrier_wait(&trabajo->barrera) == PTHREAD_BARRIER_SERIAL_THREAD) {
+            int *tmp = trabajo->frontera;
+            trabajo->frontera = trabajo->siguiente;
+            trabajo->siguiente = tmp;
+            trabajo->tamFrontera = atomic_load(&trabajo->tamSiguiente);
+            atomic_store(&trabajo->tamSiguiente, 0);
+            atomic_store(&trabajo->tomados, 0);
+            trabajo->nivel = nivelSiguiente;
+            trabajo->terminado = trabajo->tamFrontera == 0 || atomic_load(&trabajo->encontrado);
+        }
+        pthread_barrier_wait(&trabajo->barrera);
+        if (trabajo->terminado) {
+            break;
+        }
+    }
+    return NULL;
+}
+
+/*
+E: grafo, nodo inicio y meta (-1 = recorrer todo), arreglos parent y dist de tamano vertices
+   (dist puede ser NULL) y cantidad de hilos (<= 0 = todos los nucleos).
+S: BFS por niveles repartido entre hilos; parent queda como arbol BFS valido para build_path_sequence
+   y dist con la cantidad de aristas desde start (-1 = no alcanzado); retorna 1 si encontro goal.
+R: indices validos; el grafo no se modifica durante la llamada; al encontrar goal se termina su nivel.
+*/
+int bfs_paralelo(const struct Grafo *graph, int start, int goal, int *parent, int *dist, int hilos) {
+    int n = graph->vertices;
+    if (start < 0 || start >= n || parent == NULL) {
+        return 0;
+    }
+    if (hilos <= 0) {
+        hilos = hilosDisponibles();
+    }
+
+    struct TrabajoBFS trabajo;
+    trabajo.graph = graph;
+    trabajo.goal = goal;
+    trabajo.parent = parent;
+    trabajo.dist = dist;
+    trabajo.visitados = calloc(((size_t)n + 31) / 32, sizeof(atomic_uint));
+    trabajo.frontera = malloc((size_t)n * sizeof(int));
+    trabajo.siguiente = malloc((size_t)n * sizeof(int));
+    pthread_t *ids = malloc((size_t)hilos * sizeof(pthread_t));
+    if (trabajo.visitados == NULL || trabajo.frontera == NULL || trabajo.siguiente == NULL || ids == NULL) {
+        printf("No se pudo reservar memoria para BFS.\n");
+        free(trabajo.visitados);
+        free(trabajo.frontera);
+        free(trabajo.siguiente);
+        free(ids);
+        return 0;
+    }
+
+    for (int i = 0; i < n; ++i) {
+        parent[i] = -1;
+    }
+    if (dist != NULL) {
+        for (int i = 0; i < n; ++i) {
+            dist[i] = -1;
+        }
+        dist[start] = 0;
+    }
+    atomic_store(&trabajo.visitados[start >> 5], 1u << (start & 31));
+    trabajo.frontera[0] = start;
+    trabajo.tamFrontera = 1;
+    trabajo.nivel = 0;
+    trabajo.terminado = 0;
+    trabajo.listo = 0;
+    pthread_mutex_init(&trabajo.candado, NULL);
+    pthread_cond_init(&trabajo.arranque, NULL);
+    atomic_init(&trabajo.tamSiguiente, 0);
+    atomic_init(&trabajo.tomados, 0);
+    atomic_init(&trabajo.encontrado, start == goal);
+
+    //los hilos esperan en la puerta de arranque hasta que se sabe cuantos se crearon,
+    //porque la barrera de cada nivel necesita exactamente esa cantidad
+    int creados = 0;
+    if (start != goal) {
+        pthread_mutex_lock(&trabajo.candado);
+        for (int h = 1; h < hilos; ++h) {
+            if (pthread_create(&ids[creados], NULL, trabajadorBFS, &trabajo) != 0) {
+                break; //seguir con los hilos que si se crearon
+            }
+            creados++;
+        }
+        pthread_barrier_init(&trabajo.barrera, NULL, (unsigned)(creados + 1));
+        trabajo.listo = 1;
+        pthread_cond_broadcast(&trabajo.arranque);
+        pthread_mutex_unlock(&trabajo.candado);
+
+        trabajadorBFS(&trabajo);
+        for (int h = 0; h < creados; ++h) {
+            pthread_join(ids[h], NULL);
+        }
+        pthread_barrier_destroy(&trabajo.barrera);
+    }
+    pthread_mutex_destroy(&trabajo.candado);
+    pthread_cond_destroy(&trabajo.arranque);
+
+    int encontrado = atomic_load(&trabajo.encontrado);
+    free(trabajo.visitados);
+    free(trabajo.frontera);
+    free(trabajo.siguiente);
+    free(ids);
+    return encontrado;
+}
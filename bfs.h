@@ -2,8 +2,11 @@
 #define BFS_H
 
 #include "grafo.h"
+#include "espacio_busqueda.h"
 
-//declara BFS para grafos con matriz 0/1
+//declara BFS para grafos con adyacencia comprimida
 int bfs(const struct Grafo *graph, int start, int goal, int *parent, int *visitOrder, int *visitCount);
+int bfs_espacio(const struct Grafo *graph, int start, int goal, struct EspacioBusqueda *espacio);
+int bfs_paralelo(const struct Grafo *graph, int start, int goal, int *parent, int *dist, int hilos);
 
 #endif
@@ -0,0 +1,214 @@
+#include <limits.h>
+
+#include "bidireccional.h"
+
+/*
+E: grafo, padres del frente de inicio y del frente de meta, vertices del encuentro, meta.
+S: completa parent para que la cadena desde goal llegue a start pasando por el encuentro.
+R: desde esta en el frente de inicio, hasta en el de meta y son adyacentes (o iguales).
+*/
+static void unirPadres(int *parent, const int *parentMeta, int desde, int hasta, int goal) {
+    //el vertice del lado de la meta cuelga del vertice del lado del inicio
+    if (hasta != desde) {
+        parent[hasta] = desde;
+    }
+
+    //invertir la cadena del frente de meta: cada vertice pasa a ser padre del siguiente
+    int x = hasta;
+    while (x != goal) {
+        int y = parentMeta[x];
+        parent[y] = x;
+        x = y;
+    }
+}
+
+/*
+E: grafo, nodo inicio y meta, espacio del frente de inicio (ida) y del frente de meta (vuelta).
+S: ejecuta BFS desde ambos extremos; retorna 1 si hay camino y deja en ida->parent la cadena
+   goal -> start. ida->orden y vuelta->orden guardan el orden de visita de cada frente
+   (ida->cantidadOrden + vuelta->cantidadOrden vertices visitados en total).
+R: espacios distintos con capacidad >= vertices; indices validos.
+*/
+int bfs_bidireccional(const struct Grafo *graph, int start, int goal, struct EspacioBusqueda *ida, struct EspacioBusqueda *vuelta) {
+    if (ida == NULL || vuelta == NULL || ida == vuelta || ida->capacidad < graph->vertices || vuelta->capacidad < graph->vertices) {
+        return 0;
+    }
+
+    //cada frente usa su espacio: val es la distancia (sin valor = no visitado) y orden la cola FIFO
+    nuevaConsulta(ida);
+    nuevaConsulta(vuelta);
+
+    int headInicio = 0, tailInicio = 0;
+    int headMeta = 0, tailMeta = 0;
+    ida->orden[tailInicio++] = start;
+    vuelta->orden[tailMeta++] = goal;
+    espacioAsignarValor(ida, start, 0);
+    espacioAsignarValor(vuelta, goal, 0);
+    ida->parent[start] = -1;
+    vuelta->parent[goal] = -1;
+
+    //mejor encuentro visto: arista (desde, hasta) con desde en el frente de inicio
+    int mejor = INT_MAX;
+    int desde = -1;
+    int hasta = -1;
+    if (start == goal) {
+        mejor = 0;
+        desde = start;
+        hasta = goal;
+    }
+
+    //expandir niveles completos, siempre el frente con menos vertices pendientes
+    while (mejor == INT_MAX && headInicio < tailInicio && headMeta < tailMeta) {
+        int adelante = (tailInicio - headInicio) <= (tailMeta - headMeta);
+        struct EspacioBusqueda *frente = adelante ? ida : vuelta;
+        struct EspacioBusqueda *otro = adelante ? vuelta : ida;
+        int *head = adelante ? &headInicio : &headMeta;
+        int *tail = adelante ? &tailInicio : &tailMeta;
+
+        //procesar exactamente el nivel actual de este frente
+        int finNivel = *tail;
+        while (*head < finNivel) {
+            int v = frente->orden[(*head)++];
+            frente->cantidadOrden = *head;
+
+            for (int e = graph->offsets[v]; e < graph->offsets[v + 1]; ++e) {
+                int u = graph->vecinos[e];
+                if (graph->pesos[e] <= 0) {
+                    continue;
+                }
+
+                //si el otro frente ya llego a u, hay un camino; se guarda el mas corto del nivel
+                if (espacioTieneValor(otro, u)) {
+                    int total = frente->val[v] + 1 + otro->val[u];
+                    if (total < mejor) {
+                        mejor = total;
+                        desde = adelante ? v : u;
+                        hasta = adelante ? u : v;
+                    }
+                }
+
+                if (!espacioTieneValor(frente, u)) {
+                    espacioAsignarValor(frente, u, frente->val[v] + 1);
+                    frente->parent[u] = v;
+                    frente->orden[(*tail)++] = u;
+                }
+            }
+        }
+    }
+
+    int found = (mejor != INT_MAX);
+    if (found) {
+        unirPadres(ida->parent, vuelta->parent, desde, hasta, goal);
+    }
+    return found;
+}
+
+/*
+Calcula el camino mas corto entre dos nodos con Dijkstra desde ambos extremos.
+E: grafo con pesos no negativos, indices inicio y fin validos, espacio del frente de inicio (ida)
+   y del frente de meta (vuelta).
+S: retorna puntero a Camino minimo (mismo valor que dijkstra) o NULL si no hay ruta/error;
+   ida->parent queda con la cadena fin -> inicio.
+R: espacios distintos con capacidad >= vertices; si los pesos no son simetricos el frente de la
+   meta busca el peso de cada arista invertida (costo extra proporcional al grado).
+*/
+struct Camino* dijkstraBidireccional(struct Grafo* grafo, int inicio, int fin, struct EspacioBusqueda* ida, struct EspacioBusqueda* vuelta) {
+    //validar restricciones basicas
+    if (grafo == NULL || ida == NULL || vuelta == NULL || ida == vuelta || grafo->vertices <= 0 || grafo->offsets == NULL) {
+        return NULL;
+    }
+    int n = grafo->vertices;
+    if (ida->capacidad < n || vuelta->capacidad < n) {
+        return NULL;
+    }
+    if (inicio < 0 || fin < 0 || inicio >= n || fin >= n) {
+        return NULL;
+    }
+    if (!grafo->pesosNoNegativos) {
+        return NULL; //pesos negativos no permitidos
+    }
+    if (mismaComponente(grafo, inicio, fin) == 0) {
+        return NULL; //componentes distintas: no hay ruta, se evita recorrer ambos frentes
+    }
+
+    //indice 0 = frente desde el inicio, indice 1 = frente desde la meta
+    struct EspacioBusqueda* espacio[2] = {ida, vuelta};
+    struct ColaPrioridad* cola[2];
+    for (int lado = 0; lado < 2; ++lado) {
+        cola[lado] = colaDeEspacio(espacio[lado], COLA_HEAP_BINARIO, 1);
+        if (cola[lado] == NULL) {
+            return NULL;
+        }
+        cola[lado]->traza = NULL;
+        nuevaConsulta(espacio[lado]);
+    }
+    espacioAsignarValor(ida, inicio, 0);
+    espacioAsignarValor(vuelta, fin, 0);
+    ida->parent[inicio] = -1;
+    vuelta->parent[fin] = -1;
+    insertarCola(cola[0], inicio, 0);
+    insertarCola(cola[1], fin, 0);
+
+    //mejor costo conocido de un camino completo y el vertice donde se unen los frentes
+    int mejor = (inicio == fin) ? 0 : INT_MAX / 4;
+    int encuentro = (inicio == fin) ? inicio : -1;
+    int expandidos = 0;
+
+    while (cola[0]->tamano > 0 && cola[1]->tamano > 0) {
+        //criterio de parada: ningun camino por explorar puede mejorar el actual
+        int minimoInicio = valorMinimo(cola[0]);
+        int minimoMeta = valorMinimo(cola[1]);
+        if (minimoInicio + minimoMeta >= mejor) {
+            break;
+        }
+
+        //avanzar el frente cuyo minimo es menor
+        int lado = (minimoInicio <= minimoMeta) ? 0 : 1;
+        struct EspacioBusqueda* frente = espacio[lado];
+        struct EspacioBusqueda* otro = espacio[1 - lado];
+        int v = extraerMinimo(cola[lado]).vertice;
+        if (v == -1 || espacioVisitado(frente, v)) {
+            continue;
+        }
+        espacioMarcarVisitado(frente, v);
+        expandidos++;
+
+        int valV = frente->val[v];
+        for (int e = grafo->offsets[v]; e < grafo->offsets[v + 1]; ++e) {
+            int u = grafo->vecinos[e];
+            int peso = grafo->pesos[e];
+
+            //el frente de la meta recorre las aristas al reves: necesita el peso de u->v
+            if (lado == 1 && !grafo->pesosSimetricos) {
+                peso = pesoArista(grafo, u, v);
+            }
+            if (peso <= 0 || espacioVisitado(frente, u)) {
+                continue;
+            }
+
+            int nuevoVal = valV + peso;
+            if (!espacioTieneValor(frente, u) || nuevoVal < frente->val[u]) {
+                espacioAsignarValor(frente, u, nuevoVal);
+                frente->parent[u] = v;
+                insertarCola(cola[lado], u, nuevoVal);
+            }
+
+            //si el otro frente ya alcanzo u, registrar el camino que pasa por u
+            if (espacioTieneValor(otro, u) && frente->val[u] + otro->val[u] < mejor) {
+                mejor = frente->val[u] + otro->val[u];
+                encuentro = u;
+            }
+        }
+    }
+
+    struct Camino* camino = NULL;
+    if (encuentro != -1) {
+        //ida->parent queda con la cadena completa fin -> inicio
+        unirPadres(ida->parent, vuelta->parent, encuentro, encuentro, fin);
+        camino = reconstruirCamino(ida->parent, inicio, fin, mejor, n);
+        if (camino != NULL) {
+            camino->expandidos = expandidos;
+        }
+    }
+    return camino;
+}
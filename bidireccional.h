@@ -0,0 +1,11 @@
+#ifndef BIDIRECCIONAL_H
+#define BIDIRECCIONAL_H
+
+#include "grafo.h"
+#include "dijkstra.h"
+
+//busquedas que crecen un frente desde el inicio y otro desde la meta hasta que se tocan
+int bfs_bidireccional(const struct Grafo *graph, int start, int goal, struct EspacioBusqueda *ida, struct EspacioBusqueda *vuelta);
+struct Camino* dijkstraBidireccional(struct Grafo* grafo, int inicio, int fin, struct EspacioBusqueda* ida, struct EspacioBusqueda* vuelta);
+
+#endif
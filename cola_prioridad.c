@@ -0,0 +1,831 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cola_prioridad.h"
+
+//FUNCIONES PARA EL HEAP (COLA DE PRIORIDAD)
+//el mismo codigo sirve para el heap binario y el cuaternario; solo cambia la aridad
+
+/*
+E: cola de prioridad y dos indices validos dentro del heap
+S: void (intercambia elementos y actualiza posiciones)
+R: cola no nula; indices menores al tamano
+*/
+static void intercambiar(struct ColaPrioridad* cola, int i, int j) {
+    //validar restricciones
+    if (cola == NULL || i < 0 || j < 0 || i >= cola->tamano || j >= cola->tamano) {
+        return;
+    }
+
+    //intercambia los elementos en las posiciones i y j del heap
+    struct NodoPrioridad tmp = cola->heap[i];
+    cola->heap[i] = cola->heap[j];
+    cola->heap[j] = tmp;
+
+    //actualiza posiciones
+    cola->posiciones[cola->heap[i].vertice] = i;
+    cola->posiciones[cola->heap[j].vertice] = j;
+}
+
+/*
+E: cola y posicion de un elemento ya insertado
+S: sube el elemento hasta restaurar propiedad de min-heap
+R: cola existe, indice en rango
+*/
+static void subir(struct ColaPrioridad* cola, int idx) {
+    //validar restricciones
+    if (cola == NULL || idx < 0 || idx >= cola->tamano) {
+        return;
+    }
+
+    //sube el elemento mientras su valor sea menor que el de su padre
+    while (idx > 0) {
+        int padre = (idx - 1) / cola->aridad; //calcular el indice del padre
+        
+        //si el padre ya tiene un valor menor o igual, la propiedad del heap se cumple
+        if (cola->heap[padre].valor <= cola->heap[idx].valor) {
+            break;
+        }
+        
+        //intercambiar con el padre y seguir subiendo
+        intercambiar(cola, padre, idx);
+        idx = padre;
+    }
+}
+
+/*
+E: cola y posicion de un elemento ya insertado
+S: baja el elemento hasta restaurar propiedad de min-heap
+R: cola existe, indice en rango
+*/
+static void bajar(struct ColaPrioridad* cola, int idx) {
+    //validar restricciones
+    if (cola == NULL || idx < 0 || idx >= cola->tamano) {
+        return;
+    }
+
+    //baja el elemento mientras tenga un hijo con valor menor
+    while (1) {
+        int primero = cola->aridad * idx + 1; //indice del primer hijo
+        int menor = idx; //asumimos que el actual es el menor
+
+        //buscar el hijo con el menor valor (con aridad 2: izquierdo y derecho)
+        for (int k = 0; k < cola->aridad; ++k) {
+            int hijo = primero + k;
+            if (hijo >= cola->tamano) {
+                break;
+            }
+            if (cola->heap[hijo].valor < cola->heap[menor].valor) {
+                menor = hijo;
+            }
+        }
+        
+        //si el elemento actual ya es el menor, la propiedad del heap se cumple
+        if (menor == idx) {
+            break;
+        }
+        
+        //intercambiar con el hijo menor y seguir bajando
+        intercambiar(cola, idx, menor);
+        idx = menor;
+    }
+}
+
+/*
+E: heap valido, vertice y nuevo valor
+S: inserta vertice si no existe; si existe y valor mejora, actualiza prioridad
+R: heap con espacio suficiente; vertice dentro de rango [0, capacidad-1]
+*/
+static void insertarHeap(struct ColaPrioridad* cola, int vertice, int valor) {
+    //obtener la posicion actual del vertice en el heap
+    int pos = cola->posiciones[vertice];
+    
+    //si el vertice ya esta en el heap
+    if (pos != -1) {
+        //solo actualizar si el nuevo valor es menor (mejora el camino)
+        if (valor < cola->heap[pos].valor) {
+            cola->heap[pos].valor = valor; //actualizar el valor
+            subir(cola, pos); //restaurar la propiedad del heap subiendo el elemento
+        }
+        return;
+    }
+
+    //verificar que haya espacio en el heap
+    if (cola->tamano >= cola->capacidad) {
+        return; // sin espacio; no deberia ocurrir si se usa bien
+    }
+
+    //insertar el nuevo vertice al final del heap
+    int idx = cola->tamano++;
+    cola->heap[idx].vertice = vertice;
+    cola->heap[idx].valor = valor;
+    cola->posiciones[vertice] = idx; //registrar donde esta el vertice
+    
+    //subir el elemento para mantener la propiedad de min-heap
+    subir(cola, idx);
+}
+
+/*
+E: heap no vacio.
+S: extrae y retorna el elemento con menor valor.
+R: heap existe; actualizar posiciones.
+*/
+static struct NodoPrioridad extraerMinimoHeap(struct ColaPrioridad* cola) {
+    //guardar el elemento de la raiz (el de menor valor)
+    struct NodoPrioridad raiz = cola->heap[0];
+    
+    //marcar que este vertice ya no esta en el heap
+    cola->posiciones[raiz.vertice] = -1;
+
+    //reducir el tamano del heap
+    cola->tamano--;
+    
+    //si todavia quedan elementos en el heap
+    if (cola->tamano > 0) {
+        //mover el ultimo elemento a la raiz
+        cola->heap[0] = cola->heap[cola->tamano];
+        cola->posiciones[cola->heap[0].vertice] = 0; //actualizar su posicion
+        
+        //bajar este elemento para restaurar la propiedad de min-heap
+        bajar(cola, 0);
+    }
+
+    return raiz;
+}
+
+//FUNCIONES PARA LA COLA DE BUCKETS (DIAL)
+
+//cada valor v vive en el bucket v % numBuckets; como Dijkstra extrae valores no
+//decrecientes y ningun valor pendiente supera minimo + rango, no hay colisiones
+
+/*
+E: cola de buckets y vertice que esta en la cola.
+S: quita el vertice de la lista de su bucket.
+R: vertice presente en la cola.
+*/
+static void desenlazarBucket(struct ColaPrioridad* cola, int vertice) {
+    int b = cola->valores[vertice] % cola->numBuckets;
+    if (cola->anterior[vertice] != -1) {
+        cola->siguiente[cola->anterior[vertice]] = cola->siguiente[vertice];
+    } else {
+        cola->buckets[b] = cola->siguiente[vertice];
+    }
+    if (cola->siguiente[vertice] != -1) {
+        cola->anterior[cola->siguiente[vertice]] = cola->anterior[vertice];
+    }
+}
+
+/*
+E: cola de buckets, vertice y valor.
+S: agrega el vertice al frente de la lista del bucket de ese valor.
+R: vertice fuera de cualquier lista; valor no negativo.
+*/
+static void enlazarBucket(struct ColaPrioridad* cola, int vertice, int valor) {
+    int b = valor % cola->numBuckets;
+    cola->valores[vertice] = valor;
+    cola->anterior[vertice] = -1;
+    cola->siguiente[vertice] = cola->buckets[b];
+    if (cola->buckets[b] != -1) {
+        cola->anterior[cola->buckets[b]] = vertice;
+    }
+    cola->buckets[b] = vertice;
+}
+
+/*
+E: cola de buckets valida, vertice y nuevo valor.
+S: inserta o reduce el valor del vertice en O(1).
+R: la diferencia entre el mayor y el menor valor pendiente no supera el rango.
+*/
+static void insertarBuckets(struct ColaPrioridad* cola, int vertice, int valor) {
+    //si el vertice ya esta, moverlo de bucket solo si mejora
+    if (cola->posiciones[vertice] != -1) {
+        if (valor < cola->valores[vertice]) {
+            desenlazarBucket(cola, vertice);
+            enlazarBucket(cola, vertice, valor);
+            if (valor < cola->minimoActual) {
+                cola->minimoActual = valor; //el recorrido de buckets debe pasar por este valor
+            }
+        }
+        return;
+    }
+
+    //con la cola vacia (o un valor menor al actual) el recorrido de buckets empieza desde este valor
+    if (cola->tamano == 0 || valor < cola->minimoActual) {
+        cola->minimoActual = valor;
+    }
+    enlazarBucket(cola, vertice, valor);
+    cola->posiciones[vertice] = 1; //marca de presencia
+    cola->tamano++;
+}
+
+/*
+E: cola de buckets no vacia.
+S: avanza minimoActual hasta el primer bucket con elementos.
+R: tamano mayor a 0.
+*/
+static void avanzarBuckets(struct ColaPrioridad* cola) {
+    while (cola->buckets[cola->minimoActual % cola->numBuckets] == -1) {
+        cola->minimoActual++;
+    }
+}
+
+/*
+E: cola de buckets no vacia.
+S: extrae un vertice con el menor valor.
+R: tamano mayor a 0.
+*/
+static struct NodoPrioridad extraerMinimoBuckets(struct ColaPrioridad* cola) {
+    avanzarBuckets(cola);
+    int vertice = cola->buckets[cola->minimoActual % cola->numBuckets];
+    desenlazarBucket(cola, vertice);
+    cola->posiciones[vertice] = -1;
+    cola->tamano--;
+
+    struct NodoPrioridad nodo = {vertice, cola->valores[vertice]};
+    return nodo;
+}
+
+//FUNCIONES PARA EL PAIRING HEAP
+//los nodos son los propios vertices; los enlaces se guardan en arreglos por indice
+
+/*
+E: pairing heap y dos raices de subarboles (o -1).
+S: retorna la raiz de la union; la raiz mayor pasa a ser primer hijo de la menor.
+R: ambas raices sin hermanos ni previo.
+*/
+static int unirPairing(struct ColaPrioridad* cola, int a, int b) {
+    if (a == -1) {
+        return b;
+    }
+    if (b == -1) {
+        return a;
+    }
+    if (cola->valores[b] < cola->valores[a]) {
+        int tmp = a;
+        a = b;
+        b = tmp;
+    }
+
+    //b pasa al frente de la lista de hijos de a
+    cola->hermano[b] = cola->hijo[a];
+    if (cola->hijo[a] != -1) {
+        cola->previo[cola->hijo[a]] = b;
+    }
+    cola->previo[b] = a;
+    cola->hijo[a] = b;
+    return a;
+}
+
+/*
+E: pairing heap, vertice presente que no es la raiz.
+S: separa el subarbol del vertice de su padre y hermanos.
+R: vertice dentro del heap.
+*/
+static void cortarPairing(struct ColaPrioridad* cola, int vertice) {
+    int p = cola->previo[vertice];
+    if (cola->hijo[p] == vertice) {
+        cola->hijo[p] = cola->hermano[vertice]; //era el primer hijo de p
+    } else {
+        cola->hermano[p] = cola->hermano[vertice]; //p es su hermano izquierdo
+    }
+    if (cola->hermano[vertice] != -1) {
+        cola->previo[cola->hermano[vertice]] = p;
+    }
+    cola->hermano[vertice] = -1;
+    cola->previo[vertice] = -1;
+}
+
+/*
+E: pairing heap valido, vertice y nuevo valor.
+S: inserta el vertice como nueva raiz o, si ya estaba y mejora, lo corta y lo une a la raiz.
+R: vertice dentro de rango [0, capacidad-1].
+*/
+static void insertarPairing(struct ColaPrioridad* cola, int vertice, int valor) {
+    if (cola->posiciones[vertice] != -1) {
+        if (valor < cola->valores[vertice]) {
+            cola->valores[vertice] = valor;
+            if (vertice != cola->raiz) {
+                cortarPairing(cola, vertice);
+                cola->raiz = unirPairing(cola, cola->raiz, vertice);
+            }
+        }
+        return;
+    }
+
+    cola->valores[vertice] = valor;
+    cola->hijo[vertice] = -1;
+    cola->hermano[vertice] = -1;
+    cola->previo[vertice] = -1;
+    cola->raiz = unirPairing(cola, cola->raiz, vertice);
+    cola->posiciones[vertice] = 1; //marca de presencia
+    cola->tamano++;
+}
+
+/*
+E: pairing heap no vacio.
+S: extrae la raiz y une sus hijos en dos pasadas (por parejas y luego de derecha a izquierda).
+R: tamano mayor a 0.
+*/
+static struct NodoPrioridad extraerMinimoPairing(struct ColaPrioridad* cola) {
+    int r = cola->raiz;
+    struct NodoPrioridad nodo = {r, cola->valores[r]};
+
+    //primera pasada: unir hijos por parejas; los resultados se apilan usando hermano
+    int pila = -1;
+    int actual = cola->hijo[r];
+    while (actual != -1) {
+        int a = actual;
+        int b = cola->hermano[a];
+        actual = (b != -1) ? cola->hermano[b] : -1;
+
+        cola->hermano[a] = -1;
+        cola->previo[a] = -1;
+        if (b != -1) {
+            cola->hermano[b] = -1;
+            cola->previo[b] = -1;
+        }
+        int unido = unirPairing(cola, a, b);
+        cola->hermano[unido] = pila;
+        pila = unido;
+    }
+
+    //segunda pasada: la pila queda en orden inverso, asi que se une de derecha a izquierda
+    int nuevaRaiz = -1;
+    while (pila != -1) {
+        int siguienteEnPila = cola->hermano[pila];
+        cola->hermano[pila] = -1;
+        nuevaRaiz = unirPairing(cola, pila, nuevaRaiz);
+        pila = siguienteEnPila;
+    }
+    if (nuevaRaiz != -1) {
+        cola->previo[nuevaRaiz] = -1;
+        cola->hermano[nuevaRaiz] = -1;
+    }
+
+    cola->raiz = nuevaRaiz;
+    cola->hijo[r] = -1;
+    cola->posiciones[r] = -1;
+    cola->tamano--;
+    return nodo;
+}
+
+//FUNCIONES PARA EL HEAP PEREZOSO (SIN REDUCIR PRIORIDAD)
+//cada mejora agrega una entrada nueva; las entradas cuyo valor ya no coincide
+//con valores[vertice] son obsoletas y se descartan al llegar a la raiz
+
+/*
+E: heap perezoso y posicion de una entrada.
+S: sube la entrada hasta restaurar la propiedad de min-heap.
+R: indice menor a numEntradas.
+*/
+static void subirPerezoso(struct ColaPrioridad* cola, int idx) {
+    struct NodoPrioridad nodo = cola->heap[idx];
+    while (idx > 0) {
+        int padre = (idx - 1) / 2;
+        if (cola->heap[padre].valor <= nodo.valor) {
+            break;
+        }
+        cola->heap[idx] = cola->heap[padre];
+        idx = padre;
+    }
+    cola->heap[idx] = nodo;
+}
+
+/*
+E: heap perezoso y posicion de una entrada.
+S: baja la entrada hasta restaurar la propiedad de min-heap.
+R: indice menor a numEntradas.
+*/
+static void bajarPerezoso(struct ColaPrioridad* cola, int idx) {
+    struct NodoPrioridad nodo = cola->heap[idx];
+    while (1) {
+        int hijo = 2 * idx + 1;
+        if (hijo >= cola->numEntradas) {
+            break;
+        }
+        if (hijo + 1 < cola->numEntradas && cola->heap[hijo + 1].valor < cola->heap[hijo].valor) {
+            hijo++;
+        }
+        if (cola->heap[hijo].valor >= nodo.valor) {
+            break;
+        }
+        cola->heap[idx] = cola->heap[hijo];
+        idx = hijo;
+    }
+    cola->heap[idx] = nodo;
+}
+
+/*
+E: heap perezoso valido, vertice y nuevo valor.
+S: agrega una entrada si el vertice no esta o si el valor mejora; crece el arreglo si hace falta.
+R: vertice dentro de rango [0, capacidad-1].
+*/
+static void insertarPerezoso(struct ColaPrioridad* cola, int vertice, int valor) {
+    if (cola->posiciones[vertice] != -1 && valor >= cola->valores[vertice]) {
+        return; //no mejora
+    }
+
+    //duplicar el espacio de entradas cuando se llena
+    if (cola->numEntradas >= cola->capacidadEntradas) {
+        int nuevaCapacidad = cola->capacidadEntradas * 2;
+        struct NodoPrioridad* nuevo = realloc(cola->heap, (size_t)nuevaCapacidad * sizeof(struct NodoPrioridad));
+        if (nuevo == NULL) {
+            return; //sin memoria; la entrada se pierde
+        }
+        cola->heap = nuevo;
+        cola->capacidadEntradas = nuevaCapacidad;
+    }
+
+    if (cola->posiciones[vertice] == -1) {
+        cola->posiciones[vertice] = 1; //marca de presencia
+        cola->tamano++;
+    }
+    cola->valores[vertice] = valor;
+
+    int idx = cola->numEntradas++;
+    cola->heap[idx].vertice = vertice;
+    cola->heap[idx].valor = valor;
+    subirPerezoso(cola, idx);
+}
+
+/*
+E: heap perezoso.
+S: quita de la raiz las entradas obsoletas hasta dejar una vigente o vaciar el heap.
+R: ninguna.
+*/
+static void descartarObsoletos(struct ColaPrioridad* cola) {
+    while (cola->numEntradas > 0) {
+        struct NodoPrioridad raiz = cola->heap[0];
+        if (cola->posiciones[raiz.vertice] != -1 && cola->valores[raiz.vertice] == raiz.valor) {
+            return;
+        }
+        cola->heap[0] = cola->heap[--cola->numEntradas];
+        if (cola->numEntradas > 0) {
+            bajarPerezoso(cola, 0);
+        }
+    }
+}
+
+/*
+E: heap perezoso no vacio.
+S: extrae la entrada vigente con menor valor.
+R: tamano mayor a 0.
+*/
+static struct NodoPrioridad extraerMinimoPerezoso(struct ColaPrioridad* cola) {
+    descartarObsoletos(cola);
+    struct NodoPrioridad raiz = cola->heap[0];
+    cola->posiciones[raiz.vertice] = -1;
+    cola->tamano--;
+
+    cola->heap[0] = cola->heap[--cola->numEntradas];
+    if (cola->numEntradas > 0) {
+        bajarPerezoso(cola, 0);
+    }
+    return raiz;
+}
+
+//FUNCIONES PARA TRAZAS
+
+/*
+E: traza (o NULL), tipo de operacion, vertice y valor.
+S: agrega la operacion al final de la traza, creciendo el arreglo si hace falta.
+R: si no hay memoria la operacion no se registra.
+*/
+static void registrarOperacion(struct TrazaCola* traza, char tipo, int vertice, int valor) {
+    if (traza == NULL) {
+        return;
+    }
+    if (traza->cantidad >= traza->capacidad) {
+        int nuevaCapacidad = (traza->capacidad > 0) ? traza->capacidad * 2 : 1024;
+        struct OperacionCola* nuevo = realloc(traza->operaciones, (size_t)nuevaCapacidad * sizeof(struct OperacionCola));
+        if (nuevo == NULL) {
+            return;
+        }
+        traza->operaciones = nuevo;
+        traza->capacidad = nuevaCapacidad;
+    }
+    traza->operaciones[traza->cantidad].tipo = tipo;
+    traza->operaciones[traza->cantidad].vertice = vertice;
+    traza->operaciones[traza->cantidad].valor = valor;
+    traza->cantidad++;
+}
+
+/*
+E: ninguna.
+S: puntero a traza vacia o NULL si no hay memoria.
+R: liberar con liberarTrazaCola.
+*/
+struct TrazaCola* crearTrazaCola(void) {
+    return calloc(1, sizeof(struct TrazaCola));
+}
+
+/*
+E: traza valida.
+S: descarta las operaciones registradas (conserva el espacio reservado).
+R: traza puede ser NULL.
+*/
+void vaciarTrazaCola(struct TrazaCola* traza) {
+    if (traza == NULL) {
+        return;
+    }
+    traza->cantidad = 0;
+    traza->vertices = 0;
+    traza->rango = 0;
+}
+
+/*
+E: traza previamente creada.
+S: libera las operaciones y la estructura.
+R: traza puede ser NULL, no usar despues.
+*/
+void liberarTrazaCola(struct TrazaCola* traza) {
+    if (traza == NULL) {
+        return;
+    }
+    free(traza->operaciones);
+    free(traza);
+}
+
+//FUNCIONES PUBLICAS (delegan en la implementacion elegida)
+
+/*
+E: capacidad maxima, tipo de cola y rango de valores (solo para buckets).
+S: puntero a cola inicializada con posiciones en -1 o NULL en error
+R: memoria disponible; capacidad mayor a 0; para COLA_BUCKETS rango mayor a 0
+*/
+struct ColaPrioridad* crearColaPrioridadTipo(int capacidad, enum TipoCola tipo, int rango) {
+    //validaciones
+    if (capacidad <= 0 || (tipo == COLA_BUCKETS && rango <= 0)) {
+        return NULL;
+    }
+
+    //reservar memoria para la estructura principal de la cola
+    struct ColaPrioridad* cola = calloc(1, sizeof(struct ColaPrioridad));
+    if (cola == NULL) {
+        return NULL;
+    }
+
+    //reservar memoria para el heap (arreglo de nodos con prioridad)
+    cola->heap = calloc(capacidad, sizeof(struct NodoPrioridad));
+    
+    //reservar memoria para el arreglo que rastrea donde esta cada vertice en el heap
+    cola->posiciones = calloc(capacidad, sizeof(int));
+
+    //si fallo alguna asignacion de memoria, liberar todo y retornar NULL
+    if (cola->heap == NULL || cola->posiciones == NULL) {
+        free(cola->heap);
+        free(cola->posiciones);
+        free(cola);
+        return NULL;
+    }
+
+    //inicializar todas las posiciones en -1 (indica que el vertice no esta en el heap)
+    for (int i = 0; i < capacidad; ++i) {
+        cola->posiciones[i] = -1;
+    }
+    
+    //establecer la capacidad maxima y el tamano inicial en 0
+    cola->tipo = tipo;
+    cola->capacidad = capacidad;
+    cola->tamano = 0;
+    cola->aridad = (tipo == COLA_HEAP_CUATERNARIO) ? 4 : 2;
+    cola->raiz = -1;
+
+    //las colas sin heap indexado guardan el valor de cada vertice aparte
+    if (tipo == COLA_BUCKETS || tipo == COLA_PAIRING || tipo == COLA_HEAP_PEREZOSO) {
+        cola->valores = malloc((size_t)capacidad * sizeof(int));
+        if (cola->valores == NULL) {
+            liberarColaPrioridad(cola);
+            return NULL;
+        }
+    }
+
+    //la cola de buckets necesita un bucket por cada valor posible dentro del rango
+    if (tipo == COLA_BUCKETS) {
+        cola->numBuckets = rango + 1;
+        cola->buckets = malloc((size_t)cola->numBuckets * sizeof(int));
+        cola->siguiente = malloc((size_t)capacidad * sizeof(int));
+        cola->anterior = malloc((size_t)capacidad * sizeof(int));
+        if (cola->buckets == NULL || cola->siguiente == NULL || cola->anterior == NULL) {
+            liberarColaPrioridad(cola);
+            return NULL;
+        }
+        for (int b = 0; b < cola->numBuckets; ++b) {
+            cola->buckets[b] = -1;
+        }
+        cola->minimoActual = 0;
+    }
+
+    //el pairing heap enlaza los vertices entre si
+    if (tipo == COLA_PAIRING) {
+        cola->hijo = malloc((size_t)capacidad * sizeof(int));
+        cola->hermano = malloc((size_t)capacidad * sizeof(int));
+        cola->previo = malloc((size_t)capacidad * sizeof(int));
+        if (cola->hijo == NULL || cola->hermano == NULL || cola->previo == NULL) {
+            liberarColaPrioridad(cola);
+            return NULL;
+        }
+    }
+
+    //el heap perezoso empieza con una entrada por vertice y crece si hay duplicados
+    if (tipo == COLA_HEAP_PEREZOSO) {
+        cola->numEntradas = 0;
+        cola->capacidadEntradas = capacidad;
+    }
+    return cola;
+}
+
+/*
+E: capacidad maxima del heap
+S: puntero a cola (heap binario) inicializada con posiciones en -1 o NULL en error
+R: memoria disponible; capacidad mayor a 0
+*/
+struct ColaPrioridad* crearColaPrioridad(int capacidad) {
+    return crearColaPrioridadTipo(capacidad, COLA_HEAP_BINARIO, 0);
+}
+
+/*
+E: cola valida, vertice y nuevo valor
+S: inserta vertice si no existe; si existe y valor mejora, actualiza prioridad
+R: cola con espacio suficiente; vertice dentro de rango [0, capacidad-1]
+*/
+void insertarCola(struct ColaPrioridad* cola, int vertice, int valor) {
+    //validar restricciones
+    if (cola == NULL || vertice < 0 || vertice >= cola->capacidad) {
+        return;
+    }
+    registrarOperacion(cola->traza, 'I', vertice, valor);
+
+    switch (cola->tipo) {
+        case COLA_BUCKETS:
+            insertarBuckets(cola, vertice, valor);
+            break;
+        case COLA_PAIRING:
+            insertarPairing(cola, vertice, valor);
+            break;
+        case COLA_HEAP_PEREZOSO:
+            insertarPerezoso(cola, vertice, valor);
+            break;
+        case COLA_HEAP_BINARIO:
+        case COLA_HEAP_CUATERNARIO:
+            insertarHeap(cola, vertice, valor);
+            break;
+    }
+}
+
+/*
+E: cola no vacia.
+S: extrae y retorna el elemento con menor valor; si esta vacia, vertice=-1.
+R: cola creada con crearColaPrioridad o crearColaPrioridadTipo.
+*/
+struct NodoPrioridad extraerMinimo(struct ColaPrioridad* cola) {
+    //nodo nulo para retornar en caso de error
+    struct NodoPrioridad nulo = {-1, -1};
+    
+    //validar restricciones
+    if (cola == NULL || cola->tamano == 0) {
+        return nulo;
+    }
+    registrarOperacion(cola->traza, 'E', -1, -1);
+
+    switch (cola->tipo) {
+        case COLA_BUCKETS:
+            return extraerMinimoBuckets(cola);
+        case COLA_PAIRING:
+            return extraerMinimoPairing(cola);
+        case COLA_HEAP_PEREZOSO:
+            return extraerMinimoPerezoso(cola);
+        case COLA_HEAP_BINARIO:
+        case COLA_HEAP_CUATERNARIO:
+            break;
+    }
+    return extraerMinimoHeap(cola);
+}
+
+/*
+E: cola valida.
+S: deja la cola vacia para reutilizarla; el costo depende de los elementos pendientes, no de la capacidad.
+R: la cola de buckets recorre ademas sus numBuckets listas.
+*/
+void vaciarColaPrioridad(struct ColaPrioridad* cola) {
+    if (cola == NULL) {
+        return;
+    }
+
+    switch (cola->tipo) {
+        case COLA_BUCKETS:
+            for (int b = 0; b < cola->numBuckets; ++b) {
+                for (int v = cola->buckets[b]; v != -1; v = cola->siguiente[v]) {
+                    cola->posiciones[v] = -1;
+                }
+                cola->buckets[b] = -1;
+            }
+            cola->minimoActual = 0;
+            break;
+        case COLA_PAIRING: {
+            //recorrer el arbol sin pila: los hijos de cada nodo se insertan en la cadena de hermanos
+            int actual = cola->raiz;
+            while (actual != -1) {
+                int primerHijo = cola->hijo[actual];
+                if (primerHijo != -1) {
+                    int ultimo = primerHijo;
+                    while (cola->hermano[ultimo] != -1) {
+                        ultimo = cola->hermano[ultimo];
+                    }
+                    cola->hermano[ultimo] = cola->hermano[actual];
+                    cola->hermano[actual] = primerHijo;
+                    cola->hijo[actual] = -1;
+                }
+                cola->posiciones[actual] = -1;
+                actual = cola->hermano[actual];
+            }
+            cola->raiz = -1;
+            break;
+        }
+        case COLA_HEAP_PEREZOSO:
+            for (int i = 0; i < cola->numEntradas; ++i) {
+                cola->posiciones[cola->heap[i].vertice] = -1;
+            }
+            cola->numEntradas = 0;
+            break;
+        case COLA_HEAP_BINARIO:
+        case COLA_HEAP_CUATERNARIO:
+            for (int i = 0; i < cola->tamano; ++i) {
+                cola->posiciones[cola->heap[i].vertice] = -1;
+            }
+            break;
+    }
+    cola->tamano = 0;
+}
+
+/*
+E: cola no vacia.
+S: retorna el menor valor sin extraerlo; -1 si la cola esta vacia.
+R: cola valida.
+*/
+int valorMinimo(struct ColaPrioridad* cola) {
+    if (cola == NULL || cola->tamano == 0) {
+        return -1;
+    }
+
+    switch (cola->tipo) {
+        case COLA_BUCKETS:
+            avanzarBuckets(cola);
+            return cola->minimoActual;
+        case COLA_PAIRING:
+            return cola->valores[cola->raiz];
+        case COLA_HEAP_PEREZOSO:
+            descartarObsoletos(cola);
+            return cola->heap[0].valor;
+        case COLA_HEAP_BINARIO:
+        case COLA_HEAP_CUATERNARIO:
+            break;
+    }
+    return cola->heap[0].valor;
+}
+
+/*
+E: cola previamente creada.
+S: libera memoria de heap, posiciones, buckets, enlaces y la estructura.
+R: cola puede ser NULL, no usar despues.
+*/
+void liberarColaPrioridad(struct ColaPrioridad* cola) {
+    if (cola == NULL) {
+        return;
+    }
+    //liberar el arreglo del heap
+    free(cola->heap);
+    //liberar el arreglo de posiciones
+    free(cola->posiciones);
+    //liberar los arreglos de las otras implementaciones (NULL si no se usaron)
+    free(cola->buckets);
+    free(cola->siguiente);
+    free(cola->anterior);
+    free(cola->valores);
+    free(cola->hijo);
+    free(cola->hermano);
+    free(cola->previo);
+    //liberar la estructura principal
+    free(cola);
+}
+
+/*
+E: tipo de cola.
+S: retorna un nombre legible para mostrar en menus y reportes.
+R: ninguna.
+*/
+const char* nombreTipoCola(enum TipoCola tipo) {
+    switch (tipo) {
+        case COLA_HEAP_BINARIO:
+            return "heap binario";
+        case COLA_BUCKETS:
+            return "buckets (Dial)";
+        case COLA_HEAP_CUATERNARIO:
+            return "heap 4-ario";
+        case COLA_PAIRING:
+            return "pairing heap";
+        case COLA_HEAP_PEREZOSO:
+            return "heap perezoso";
+    }
+    return "desconocida";
+}
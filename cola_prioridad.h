@@ -0,0 +1,85 @@
+#ifndef COLA_PRIORIDAD_H
+#define COLA_PRIORIDAD_H
+
+//implementaciones disponibles para la cola de prioridad
+enum TipoCola {
+    COLA_HEAP_BINARIO, //min-heap binario con posiciones para reducir prioridad
+    COLA_BUCKETS, //cola de buckets de Dial, para valores enteros pequenos y monotonos
+    COLA_HEAP_CUATERNARIO, //min-heap de 4 hijos por nodo: arbol mas bajo y mejor localidad
+    COLA_PAIRING, //pairing heap: insertar y reducir prioridad en O(1)
+    COLA_HEAP_PEREZOSO //heap binario sin reducir prioridad: inserta duplicados y descarta los viejos al extraer
+};
+
+#define NUM_TIPOS_COLA 5
+
+//nodo actual al que se esta comparando el valor
+//estructura para la cola de prioridad (min-heap)
+struct NodoPrioridad {
+    int vertice;   //nodo/vertice del grafo
+    int valor; //valor acumulado desde el inicio
+};
+
+//operacion registrada en una traza: 'I' = insertar/reducir, 'E' = extraer minimo
+struct OperacionCola {
+    char tipo;
+    int vertice;
+    int valor;
+};
+
+//secuencia de operaciones hechas sobre una cola durante una busqueda real,
+//para reproducirla despues contra cada implementacion
+struct TrazaCola {
+    struct OperacionCola* operaciones;
+    int cantidad; //operaciones registradas
+    int capacidad; //espacio reservado en operaciones
+    int vertices; //capacidad de la cola que genero la traza
+    int rango; //rango de valores de la cola que genero la traza
+};
+
+//estructura que mantiene los nodos ordenados por valor (el de menor valor esta al frente)
+//se ocupa el menor para saber por cuales aristas son las que menos costo de pasar tienen
+struct ColaPrioridad {
+    enum TipoCola tipo; //implementacion elegida al crear la cola
+    struct NodoPrioridad* heap;
+    int* posiciones; //para actualizaciones de prioridades (-1 si el vertice no esta en la cola)
+    int tamano; //cuantos elementos hay en la cola
+    int capacidad; //tamano maximo de la cola (numero de vertices del grafo)
+    int aridad; //hijos por nodo en los heaps d-arios (2 o 4)
+
+    //campos de la cola de buckets: un arreglo circular de listas doblemente enlazadas
+    int* buckets; //primer vertice de cada bucket o -1 si esta vacio
+    int numBuckets; //rango maximo de valores simultaneos + 1
+    int* siguiente; //siguiente vertice en el mismo bucket
+    int* anterior; //vertice anterior en el mismo bucket
+    int* valores; //valor actual de cada vertice dentro de la cola (buckets, pairing y perezoso)
+    int minimoActual; //valor del bucket desde donde se busca el siguiente minimo
+
+    //campos del pairing heap: cada vertice es un nodo con primer hijo y hermano derecho
+    int* hijo; //primer hijo o -1
+    int* hermano; //hermano derecho o -1
+    int* previo; //hermano izquierdo, o el padre si es el primer hijo; -1 en la raiz
+    int raiz; //vertice en la raiz o -1 si esta vacio
+
+    //campos del heap perezoso: heap puede tener varias entradas por vertice
+    int numEntradas; //entradas en heap, incluidas las obsoletas
+    int capacidadEntradas; //espacio reservado en heap
+
+    struct TrazaCola* traza; //si no es NULL, cada operacion se registra aqui
+};
+
+// funciones de cola de prioridad
+struct ColaPrioridad* crearColaPrioridad(int capacidad);
+struct ColaPrioridad* crearColaPrioridadTipo(int capacidad, enum TipoCola tipo, int rango);
+void insertarCola(struct ColaPrioridad* cola, int vertice, int valor);
+struct NodoPrioridad extraerMinimo(struct ColaPrioridad* cola);
+int valorMinimo(struct ColaPrioridad* cola);
+void vaciarColaPrioridad(struct ColaPrioridad* cola);
+void liberarColaPrioridad(struct ColaPrioridad* cola);
+const char* nombreTipoCola(enum TipoCola tipo);
+
+// funciones de trazas
+struct TrazaCola* crearTrazaCola(void);
+void vaciarTrazaCola(struct TrazaCola* traza);
+void liberarTrazaCola(struct TrazaCola* traza);
+
+#endif
@@ -0,0 +1,79 @@
+#include <stdlib.h>
+
+#include "conjuntos.h"
+
+/*
+E: cantidad de elementos mayor a 0.
+S: puntero a conjuntos donde cada elemento esta solo, o NULL en error.
+R: memoria para 2 enteros por elemento.
+*/
+struct ConjuntosDisjuntos* crearConjuntos(int cantidad) {
+    if (cantidad <= 0) {
+        return NULL;
+    }
+    struct ConjuntosDisjuntos* conjuntos = calloc(1, sizeof(struct ConjuntosDisjuntos));
+    if (conjuntos == NULL) {
+        return NULL;
+    }
+    conjuntos->cantidad = cantidad;
+    conjuntos->padre = malloc((size_t)cantidad * sizeof(int));
+    conjuntos->tamano = malloc((size_t)cantidad * sizeof(int));
+    if (conjuntos->padre == NULL || conjuntos->tamano == NULL) {
+        liberarConjuntos(conjuntos);
+        return NULL;
+    }
+    for (int i = 0; i < cantidad; ++i) {
+        conjuntos->padre[i] = i;
+        conjuntos->tamano[i] = 1;
+    }
+    return conjuntos;
+}
+
+/*
+E: conjuntos y elemento x.
+S: representante del conjunto de x; acorta el camino recorrido (cada nodo apunta a su abuelo).
+R: x dentro de [0, cantidad-1].
+*/
+int buscarConjunto(struct ConjuntosDisjuntos* conjuntos, int x) {
+    int* padre = conjuntos->padre;
+    while (padre[x] != x) {
+        padre[x] = padre[padre[x]];
+        x = padre[x];
+    }
+    return x;
+}
+
+/*
+E: conjuntos y dos elementos.
+S: une sus conjuntos colgando el menor del mayor; retorna 1 si estaban separados, 0 si ya estaban juntos.
+R: elementos dentro de [0, cantidad-1].
+*/
+int unirConjuntos(struct ConjuntosDisjuntos* conjuntos, int a, int b) {
+    a = buscarConjunto(conjuntos, a);
+    b = buscarConjunto(conjuntos, b);
+    if (a == b) {
+        return 0;
+    }
+    if (conjuntos->tamano[a] < conjuntos->tamano[b]) {
+        int tmp = a;
+        a = b;
+        b = tmp;
+    }
+    conjuntos->padre[b] = a;
+    conjuntos->tamano[a] += conjuntos->tamano[b];
+    return 1;
+}
+
+/*
+E: conjuntos previamente creados.
+S: libera los arreglos y la estructura.
+R: conjuntos puede ser NULL, no usar despues.
+*/
+void liberarConjuntos(struct ConjuntosDisjuntos* conjuntos) {
+    if (conjuntos == NULL) {
+        return;
+    }
+    free(conjuntos->padre);
+    free(conjuntos->tamano);
+    free(conjuntos);
+}
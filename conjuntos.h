@@ -0,0 +1,18 @@
+#ifndef CONJUNTOS_H
+#define CONJUNTOS_H
+
+//conjuntos disjuntos (union-find) con union por tamano y compresion de caminos por mitades;
+//cada operacion cuesta casi O(1) amortizado
+struct ConjuntosDisjuntos {
+    int cantidad; //elementos 0 .. cantidad-1
+    int* padre; //padre[x] == x si x es representante
+    int* tamano; //tamano del conjunto (solo valido en representantes)
+};
+
+// funciones de conjuntos disjuntos
+struct ConjuntosDisjuntos* crearConjuntos(int cantidad);
+int buscarConjunto(struct ConjuntosDisjuntos* conjuntos, int x);
+int unirConjuntos(struct ConjuntosDisjuntos* conjuntos, int a, int b);
+void liberarConjuntos(struct ConjuntosDisjuntos* conjuntos);
+
+#endif
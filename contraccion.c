@@ -0,0 +1,601 @@
+#include <limits.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "contraccion.h"
+#include "reloj.h"
+
+//vertices asentados como maximo en cada busqueda de testigos; si se corta antes de
+//encontrar un testigo se agrega el atajo (sobran atajos pero nunca faltan)
+#define LIMITE_TESTIGO 256
+#define LIMITE_SIMULACION 32 //limite menor para estimar prioridades
+
+//arista del grafo que se va contrayendo
+struct AristaJerarquia {
+    int destino;
+    int peso;
+    int medio; //vertice contraido que reemplaza, o -1 si es original
+};
+
+//lista de aristas de un vertice aun no contraido; al contraerlo queda congelada
+//y contiene exactamente sus aristas hacia vecinos de mayor rango
+struct ListaJerarquia {
+    struct AristaJerarquia* aristas;
+    int cantidad;
+    int capacidad;
+};
+
+/*
+E: lista de un vertice, destino, peso y vertice medio.
+S: agrega o mejora la arista hacia destino (se conserva el menor peso); retorna 1 si se agrego
+   una arista nueva, 0 si ya existia y -1 si falta memoria.
+R: destino distinto del vertice duenio de la lista.
+*/
+static int agregarAristaLista(struct ListaJerarquia* lista, int destino, int peso, int medio) {
+    for (int i = 0; i < lista->cantidad; ++i) {
+        if (lista->aristas[i].destino == destino) {
+            if (peso < lista->aristas[i].peso) {
+                lista->aristas[i].peso = peso;
+                lista->aristas[i].medio = medio;
+            }
+            return 0;
+        }
+    }
+    if (lista->cantidad == lista->capacidad) {
+        int nuevaCapacidad = lista->capacidad > 0 ? lista->capacidad * 2 : 4;
+        struct AristaJerarquia* nuevas = realloc(lista->aristas, (size_t)nuevaCapacidad * sizeof(struct AristaJerarquia));
+        if (nuevas == NULL) {
+            return -1;
+        }
+        lista->aristas = nuevas;
+        lista->capacidad = nuevaCapacidad;
+    }
+    lista->aristas[lista->cantidad].destino = destino;
+    lista->aristas[lista->cantidad].peso = peso;
+    lista->aristas[lista->cantidad].medio = medio;
+    lista->cantidad++;
+    return 1;
+}
+
+/*
+E: lista de un vertice y destino a quitar.
+S: elimina la arista hacia destino si existe (sin conservar el orden).
+R: ninguna.
+*/
+static void quitarAristaLista(struct ListaJerarquia* lista, int destino) {
+    for (int i = 0; i < lista->cantidad; ++i) {
+        if (lista->aristas[i].destino == destino) {
+            lista->aristas[i] = lista->aristas[lista->cantidad - 1];
+            lista->cantidad--;
+            return;
+        }
+    }
+}
+
+//atajo que necesita la contraccion del vertice actual
+struct AtajoPendiente {
+    int u;
+    int w;
+    int peso;
+};
+
+//estado de la contraccion compartido por las funciones auxiliares
+struct EstadoContraccion {
+    struct ListaJerarquia* listas; //grafo restante: aristas entre vertices aun no contraidos
+    int* contraidos; //vecinos ya contraidos de cada vertice
+    int* profundidad; //nivel de la jerarquia que alcanza cada vertice por debajo
+    int* objetivo; //numero de la busqueda de testigos en la que cada vertice es destino
+    int busqueda; //busquedas de testigos hechas
+    int limite; //vertices asentados como maximo en cada busqueda de testigos
+    struct AtajoPendiente* pendientes; //atajos de la ultima simulacion
+    int cantidadPendientes;
+    int capacidadPendientes;
+    struct EspacioBusqueda* espacio; //espacio y cola de las busquedas de testigos
+    struct ColaPrioridad* cola;
+};
+
+/*
+E: estado, origen, vertice excluido (el que se contrae), distancia maxima de interes y destinos marcados
+   en objetivo con el numero de la busqueda actual.
+S: Dijkstra local desde origen que no pasa por excluido y termina al asentar todos los destinos;
+   espacio->val queda con cotas superiores de las distancias a los vertices alcanzados.
+R: espacio y cola con capacidad para todos los vertices.
+*/
+static void buscarTestigos(struct EstadoContraccion* estado, int origen, int excluido, int maximo, int destinos) {
+    struct EspacioBusqueda* espacio = estado->espacio;
+    struct ColaPrioridad* cola = estado->cola;
+    nuevaConsulta(espacio);
+    espacioAsignarValor(espacio, origen, 0);
+    insertarCola(cola, origen, 0);
+
+    int asentados = 0;
+    while (cola->tamano > 0 && destinos > 0) {
+        struct NodoPrioridad actual = extraerMinimo(cola);
+        int v = actual.vertice;
+        if (actual.valor > maximo || ++asentados > estado->limite) {
+            break;
+        }
+        espacioMarcarVisitado(espacio, v);
+        if (estado->objetivo[v] == estado->busqueda) {
+            destinos--;
+        }
+
+        const struct ListaJerarquia* lista = &estado->listas[v];
+        for (int i = 0; i < lista->cantidad; ++i) {
+            int u = lista->aristas[i].destino;
+            if (u == excluido || espacioVisitado(espacio, u)) {
+                continue;
+            }
+            int nuevoVal = actual.valor + lista->aristas[i].peso;
+            if (nuevoVal <= maximo && (!espacioTieneValor(espacio, u) || nuevoVal < espacio->val[u])) {
+                espacioAsignarValor(espacio, u, nuevoVal);
+                insertarCola(cola, u, nuevoVal);
+            }
+        }
+    }
+    vaciarColaPrioridad(cola);
+}
+
+/*
+E: estado y vertice v.
+S: deja en estado->pendientes los atajos que necesita la contraccion de v y retorna cuantos son
+   (-1 si falta memoria).
+R: v aun no contraido.
+*/
+static int simularContraccion(struct EstadoContraccion* estado, int v) {
+    const struct ListaJerarquia* lista = &estado->listas[v];
+    estado->cantidadPendientes = 0;
+
+    //cada par de vecinos u, w necesita un atajo si no hay testigo u -> w mas corto o igual que u - v - w
+    for (int i = 0; i + 1 < lista->cantidad; ++i) {
+        int u = lista->aristas[i].destino;
+        int pesoU = lista->aristas[i].peso;
+        int maximo = 0;
+        estado->busqueda++;
+        for (int j = i + 1; j < lista->cantidad; ++j) {
+            if (pesoU + lista->aristas[j].peso > maximo) {
+                maximo = pesoU + lista->aristas[j].peso;
+            }
+            estado->objetivo[lista->aristas[j].destino] = estado->busqueda;
+        }
+
+        buscarTestigos(estado, u, v, maximo, lista->cantidad - i - 1);
+
+        for (int j = i + 1; j < lista->cantidad; ++j) {
+            int w = lista->aristas[j].destino;
+            int peso = pesoU + lista->aristas[j].peso;
+            if (espacioTieneValor(estado->espacio, w) && estado->espacio->val[w] <= peso) {
+                continue;
+            }
+            if (estado->cantidadPendientes == estado->capacidadPendientes) {
+                int nuevaCapacidad = estado->capacidadPendientes > 0 ? estado->capacidadPendientes * 2 : 16;
+                struct AtajoPendiente* nuevos = realloc(estado->pendientes, (size_t)nuevaCapacidad * sizeof(struct AtajoPendiente));
+                if (nuevos == NULL) {
+                    return -1;
+                }
+                estado->pendientes = nuevos;
+                estado->capacidadPendientes = nuevaCapacidad;
+            }
+            struct AtajoPendiente atajo = {u, w, peso};
+            estado->pendientes[estado->cantidadPendientes++] = atajo;
+        }
+    }
+    return estado->cantidadPendientes;
+}
+
+/*
+E: estado y vertice v.
+S: prioridad de contraccion de v: diferencia de aristas (atajos - aristas quitadas) con mas peso,
+   mas vecinos contraidos y profundidad, para contraer primero los vertices que menos agregan y
+   repartir la contraccion por todo el grafo; INT_MAX si falta memoria.
+R: v aun no contraido.
+*/
+static int prioridadVertice(struct EstadoContraccion* estado, int v) {
+    estado->limite = LIMITE_SIMULACION;
+    int atajos = simularContraccion(estado, v);
+    if (atajos < 0) {
+        return INT_MAX;
+    }
+    return 4 * (atajos - estado->listas[v].cantidad) + estado->contraidos[v] + estado->profundidad[v];
+}
+
+/*
+E: estado y vertice v cuya simulacion esta en estado->pendientes.
+S: agrega los atajos pendientes, saca a v del grafo restante y retorna 0, o -1 si falta memoria.
+R: la lista de v queda congelada con sus vecinos de mayor rango.
+*/
+static int contraerVertice(struct EstadoContraccion* estado, int v) {
+    for (int i = 0; i < estado->cantidadPendientes; ++i) {
+        struct AtajoPendiente atajo = estado->pendientes[i];
+        if (agregarAristaLista(&estado->listas[atajo.u], atajo.w, atajo.peso, v) < 0
+            || agregarAristaLista(&estado->listas[atajo.w], atajo.u, atajo.peso, v) < 0) {
+            return -1;
+        }
+    }
+
+    const struct ListaJerarquia* lista = &estado->listas[v];
+    for (int i = 0; i < lista->cantidad; ++i) {
+        int u = lista->aristas[i].destino;
+        quitarAristaLista(&estado->listas[u], v);
+        estado->contraidos[u]++;
+        if (estado->profundidad[u] < estado->profundidad[v] + 1) {
+            estado->profundidad[u] = estado->profundidad[v] + 1;
+        }
+    }
+    return 0;
+}
+
+/*
+E: estado de la contraccion y cantidad de vertices.
+S: libera las listas y los arreglos auxiliares.
+R: campos en NULL se ignoran.
+*/
+static void liberarEstado(struct EstadoContraccion* estado, int n) {
+    if (estado->listas != NULL) {
+        for (int v = 0; v < n; ++v) {
+            free(estado->listas[v].aristas);
+        }
+    }
+    free(estado->listas);
+    free(estado->contraidos);
+    free(estado->profundidad);
+    free(estado->objetivo);
+    free(estado->pendientes);
+    liberarEspacioBusqueda(estado->espacio);
+}
+
+/*
+E: grafo no dirigido con pesos no negativos y simetricos.
+S: puntero a jerarquia con el orden de contraccion y el grafo ascendente con atajos, o NULL en error.
+R: las aristas con peso 0 (eliminadas) no se usan; entre aristas paralelas se conserva la menor;
+   el grafo ascendente guarda un solo peso por arista, por eso se rechazan pesos no simetricos.
+*/
+struct JerarquiaContraccion* construirJerarquia(const struct Grafo* grafo) {
+    if (grafo == NULL || grafo->vertices <= 0 || !grafo->pesosNoNegativos || !grafo->pesosSimetricos) {
+        return NULL;
+    }
+    int n = grafo->vertices;
+
+    struct timespec antes;
+    timespec_get(&antes, TIME_UTC);
+
+    struct JerarquiaContraccion* jerarquia = calloc(1, sizeof(struct JerarquiaContraccion));
+    struct EstadoContraccion estado = {0};
+    estado.listas = calloc((size_t)n, sizeof(struct ListaJerarquia));
+    estado.contraidos = calloc((size_t)n, sizeof(int));
+    estado.profundidad = calloc((size_t)n, sizeof(int));
+    estado.objetivo = calloc((size_t)n, sizeof(int));
+    estado.espacio = crearEspacioBusqueda(n);
+    estado.cola = estado.espacio != NULL ? colaDeEspacio(estado.espacio, COLA_HEAP_BINARIO, 1) : NULL;
+    struct ColaPrioridad* orden = crearColaPrioridadTipo(n, COLA_HEAP_BINARIO, 1);
+    if (jerarquia != NULL) {
+        jerarquia->rango = malloc((size_t)n * sizeof(int));
+        jerarquia->offsets = malloc(((size_t)n + 1) * sizeof(int));
+    }
+    int error = jerarquia == NULL || jerarquia->rango == NULL || jerarquia->offsets == NULL || estado.listas == NULL
+                || estado.contraidos == NULL || estado.profundidad == NULL || estado.objetivo == NULL
+                || estado.cola == NULL || orden == NULL;
+
+    //copiar las aristas vigentes, sin duplicados ni lazos
+    for (int v = 0; v < n && !error; ++v) {
+        for (int e = grafo->offsets[v]; e < grafo->offsets[v + 1]; ++e) {
+            int u = grafo->vecinos[e];
+            if (grafo->pesos[e] <= 0 || u == v) {
+                continue;
+            }
+            int agregada = agregarAristaLista(&estado.listas[v], u, grafo->pesos[e], -1);
+            if (agregada < 0) {
+                error = 1;
+                break;
+            }
+            if (agregada == 1 && v < u) {
+                jerarquia->aristasOriginales++;
+            }
+        }
+    }
+
+    for (int v = 0; v < n && !error; ++v) {
+        insertarCola(orden, v, prioridadVertice(&estado, v));
+    }
+
+    //actualizacion perezosa: la prioridad se recalcula al extraer y, si ya no es la menor,
+    //el vertice vuelve a la cola
+    int nivel = 0;
+    while (!error && orden->tamano > 0) {
+        int v = extraerMinimo(orden).vertice;
+        int prioridad = prioridadVertice(&estado, v);
+        if (prioridad == INT_MAX) {
+            error = 1;
+            break;
+        }
+        if (orden->tamano > 0 && prioridad > valorMinimo(orden)) {
+            insertarCola(orden, v, prioridad);
+            continue;
+        }
+
+        //la prioridad se estima con busquedas cortas; la contraccion real repite la simulacion
+        //con el limite completo para no agregar atajos de mas
+        estado.limite = LIMITE_TESTIGO;
+        if (simularContraccion(&estado, v) < 0 || contraerVertice(&estado, v) < 0) {
+            error = 1;
+            break;
+        }
+        jerarquia->atajos += estado.cantidadPendientes;
+        jerarquia->rango[v] = nivel++;
+    }
+
+    //armar el grafo ascendente en adyacencia comprimida
+    if (!error) {
+        jerarquia->offsets[0] = 0;
+        for (int v = 0; v < n; ++v) {
+            jerarquia->offsets[v + 1] = jerarquia->offsets[v] + estado.listas[v].cantidad;
+        }
+        int total = jerarquia->offsets[n];
+        size_t bytes = (size_t)(total > 0 ? total : 1) * sizeof(int);
+        jerarquia->vecinos = malloc(bytes);
+        jerarquia->pesos = malloc(bytes);
+        jerarquia->medios = malloc(bytes);
+        error = jerarquia->vecinos == NULL || jerarquia->pesos == NULL || jerarquia->medios == NULL;
+    }
+    if (!error) {
+        for (int v = 0; v < n; ++v) {
+            int base = jerarquia->offsets[v];
+            for (int i = 0; i < estado.listas[v].cantidad; ++i) {
+                jerarquia->vecinos[base + i] = estado.listas[v].aristas[i].destino;
+                jerarquia->pesos[base + i] = estado.listas[v].aristas[i].peso;
+                jerarquia->medios[base + i] = estado.listas[v].aristas[i].medio;
+            }
+        }
+        jerarquia->vertices = n;
+    }
+
+    liberarEstado(&estado, n);
+    liberarColaPrioridad(orden);
+    if (error) {
+        liberarJerarquia(jerarquia);
+        return NULL;
+    }
+
+    jerarquia->segundosPreproceso = segundosDesde(&antes);
+    return jerarquia;
+}
+
+/*
+E: jerarquia, vertice v y vecino u.
+S: indice de la arista v -> u en el grafo ascendente, o -1 si no existe.
+R: v valido.
+*/
+static int buscarAristaAscendente(const struct JerarquiaContraccion* jerarquia, int v, int u) {
+    for (int e = jerarquia->offsets[v]; e < jerarquia->offsets[v + 1]; ++e) {
+        if (jerarquia->vecinos[e] == u) {
+            return e;
+        }
+    }
+    return -1;
+}
+
+/*
+E: jerarquia e indice de arista del grafo ascendente.
+S: vertice al que pertenece la arista (busqueda binaria en offsets).
+R: indice dentro de [0, offsets[vertices] - 1].
+*/
+static int origenArista(const struct JerarquiaContraccion* jerarquia, int e) {
+    int bajo = 0;
+    int alto = jerarquia->vertices - 1;
+    while (bajo < alto) {
+        int medio = bajo + (alto - bajo + 1) / 2;
+        if (jerarquia->offsets[medio] <= e) {
+            bajo = medio;
+        } else {
+            alto = medio - 1;
+        }
+    }
+    return bajo;
+}
+
+//tramo pendiente de desempacar: arista a - b que reemplaza al vertice medio (-1 si es original)
+struct TramoJerarquia {
+    int a;
+    int b;
+    int medio;
+};
+
+/*
+E: jerarquia, tramo a - b con su vertice medio, arreglo de salida con su cantidad y capacidad, pila auxiliar.
+S: agrega a la salida los vertices originales despues de a hasta b inclusive; retorna 0 o -1 si falta memoria.
+R: el tramo es una arista del grafo ascendente; pila y salida crecen con realloc.
+*/
+static int desempacarTramo(const struct JerarquiaContraccion* jerarquia, struct TramoJerarquia tramo,
+                           int** salida, int* cantidad, int* capacidad,
+                           struct TramoJerarquia** pila, int* capacidadPila) {
+    int tope = 0;
+    (*pila)[tope++] = tramo;
+    while (tope > 0) {
+        struct TramoJerarquia actual = (*pila)[--tope];
+        if (actual.medio == -1) {
+            if (*cantidad == *capacidad) {
+                int nuevaCapacidad = *capacidad * 2;
+                int* nuevos = realloc(*salida, (size_t)nuevaCapacidad * sizeof(int));
+                if (nuevos == NULL) {
+                    return -1;
+                }
+                *salida = nuevos;
+                *capacidad = nuevaCapacidad;
+            }
+            (*salida)[(*cantidad)++] = actual.b;
+            continue;
+        }
+
+        //el medio se contrajo antes que a y b, asi que sus aristas hacia ambos estan en su lista
+        int m = actual.medio;
+        int haciaA = buscarAristaAscendente(jerarquia, m, actual.a);
+        int haciaB = buscarAristaAscendente(jerarquia, m, actual.b);
+        if (haciaA < 0 || haciaB < 0) {
+            return -1;
+        }
+        if (tope + 2 > *capacidadPila) {
+            int nuevaCapacidad = *capacidadPila * 2;
+            struct TramoJerarquia* nueva = realloc(*pila, (size_t)nuevaCapacidad * sizeof(struct TramoJerarquia));
+            if (nueva == NULL) {
+                return -1;
+            }
+            *pila = nueva;
+            *capacidadPila = nuevaCapacidad;
+        }
+        //se apila primero m - b para procesar antes a - m
+        struct TramoJerarquia segundo = {m, actual.b, jerarquia->medios[haciaB]};
+        struct TramoJerarquia primero = {actual.a, m, jerarquia->medios[haciaA]};
+        (*pila)[tope++] = segundo;
+        (*pila)[tope++] = primero;
+    }
+    return 0;
+}
+
+/*
+E: jerarquia, cola de un lado, su espacio y el del otro lado, mejor valor y vertice de encuentro.
+S: asienta el minimo de la cola y relaja sus aristas ascendentes, actualizando el mejor encuentro.
+R: cola no vacia; parent guarda el indice de la arista ascendente usada para llegar.
+*/
+static void avanzarLado(const struct JerarquiaContraccion* jerarquia, struct ColaPrioridad* cola,
+                        struct EspacioBusqueda* propio, const struct EspacioBusqueda* otro,
+                        int* mejor, int* encuentro) {
+    struct NodoPrioridad actual = extraerMinimo(cola);
+    int v = actual.vertice;
+    espacioMarcarVisitado(propio, v);
+
+    int valV = propio->val[v];
+    for (int e = jerarquia->offsets[v]; e < jerarquia->offsets[v + 1]; ++e) {
+        int u = jerarquia->vecinos[e];
+        int nuevoVal = valV + jerarquia->pesos[e];
+        if (espacioVisitado(propio, u) || (espacioTieneValor(propio, u) && nuevoVal >= propio->val[u])) {
+            continue;
+        }
+        espacioAsignarValor(propio, u, nuevoVal);
+        propio->parent[u] = e;
+        insertarCola(cola, u, nuevoVal);
+
+        if (espacioTieneValor(otro, u) && nuevoVal + otro->val[u] < *mejor) {
+            *mejor = nuevoVal + otro->val[u];
+            *encuentro = u;
+        }
+    }
+}
+
+/*
+Calcula el camino mas corto con una busqueda bidireccional que solo sube de rango.
+E: jerarquia, indices inicio y fin, dos espacios de busqueda (uno por direccion).
+S: retorna puntero a Camino minimo con los vertices del grafo original (mismo valor que dijkstra),
+   o NULL si no hay ruta/error.
+R: el grafo no cambio desde construirJerarquia; espacios con capacidad >= vertices.
+*/
+struct Camino* caminoJerarquia(const struct JerarquiaContraccion* jerarquia, int inicio, int fin,
+                               struct EspacioBusqueda* ida, struct EspacioBusqueda* vuelta) {
+    if (jerarquia == NULL || ida == NULL || vuelta == NULL || ida == vuelta
+        || ida->capacidad < jerarquia->vertices || vuelta->capacidad < jerarquia->vertices) {
+        return NULL;
+    }
+    int n = jerarquia->vertices;
+    if (inicio < 0 || fin < 0 || inicio >= n || fin >= n) {
+        return NULL;
+    }
+
+    struct ColaPrioridad* colaIda = colaDeEspacio(ida, COLA_HEAP_BINARIO, 1);
+    struct ColaPrioridad* colaVuelta = colaDeEspacio(vuelta, COLA_HEAP_BINARIO, 1);
+    if (colaIda == NULL || colaVuelta == NULL) {
+        return NULL;
+    }
+    colaIda->traza = NULL;
+    colaVuelta->traza = NULL;
+    nuevaConsulta(ida);
+    nuevaConsulta(vuelta);
+    espacioAsignarValor(ida, inicio, 0);
+    espacioAsignarValor(vuelta, fin, 0);
+    ida->parent[inicio] = -1;
+    vuelta->parent[fin] = -1;
+    insertarCola(colaIda, inicio, 0);
+    insertarCola(colaVuelta, fin, 0);
+
+    int mejor = inicio == fin ? 0 : INT_MAX;
+    int encuentro = inicio == fin ? inicio : -1;
+    int expandidos = 0;
+
+    //cada lado avanza mientras su minimo pueda mejorar el encuentro; el camino minimo
+    //sube hasta un vertice de rango maximo y baja, y ambos tramos son ascendentes
+    while (1) {
+        int minimoIda = colaIda->tamano > 0 ? valorMinimo(colaIda) : INT_MAX;
+        int minimoVuelta = colaVuelta->tamano > 0 ? valorMinimo(colaVuelta) : INT_MAX;
+        if (minimoIda >= mejor && minimoVuelta >= mejor) {
+            break;
+        }
+        if (minimoIda <= minimoVuelta) {
+            avanzarLado(jerarquia, colaIda, ida, vuelta, &mejor, &encuentro);
+        } else {
+            avanzarLado(jerarquia, colaVuelta, vuelta, ida, &mejor, &encuentro);
+        }
+        expandidos++;
+    }
+    vaciarColaPrioridad(colaIda);
+    vaciarColaPrioridad(colaVuelta);
+
+    if (encuentro == -1) {
+        return NULL;
+    }
+
+    //las aristas inicio -> encuentro se juntan en ida->orden desde el encuentro y se desempacan al reves;
+    //las de encuentro -> fin se desempacan en el orden en que se recorren
+    int capacidad = 64;
+    int capacidadPila = 64;
+    int cantidad = 0;
+    int* salida = malloc((size_t)capacidad * sizeof(int));
+    struct TramoJerarquia* pila = malloc((size_t)capacidadPila * sizeof(struct TramoJerarquia));
+    int tramos = 0;
+    int error = salida == NULL || pila == NULL;
+    if (!error) {
+        salida[cantidad++] = inicio;
+        for (int v = encuentro; ida->parent[v] != -1; ) {
+            ida->orden[tramos++] = ida->parent[v];
+            v = origenArista(jerarquia, ida->parent[v]);
+        }
+    }
+    for (int i = tramos - 1; i >= 0 && !error; --i) {
+        int e = ida->orden[i];
+        struct TramoJerarquia tramo = {origenArista(jerarquia, e), jerarquia->vecinos[e], jerarquia->medios[e]};
+        error = desempacarTramo(jerarquia, tramo, &salida, &cantidad, &capacidad, &pila, &capacidadPila) < 0;
+    }
+    for (int v = encuentro; !error && vuelta->parent[v] != -1; ) {
+        int e = vuelta->parent[v];
+        int siguiente = origenArista(jerarquia, e);
+        struct TramoJerarquia tramo = {v, siguiente, jerarquia->medios[e]};
+        error = desempacarTramo(jerarquia, tramo, &salida, &cantidad, &capacidad, &pila, &capacidadPila) < 0;
+        v = siguiente;
+    }
+    free(pila);
+
+    struct Camino* camino = error ? NULL : malloc(sizeof(struct Camino));
+    if (camino == NULL) {
+        free(salida);
+        return NULL;
+    }
+    camino->nodos = salida;
+    camino->longitud = cantidad;
+    camino->valorTotal = mejor;
+    camino->expandidos = expandidos;
+    return camino;
+}
+
+/*
+E: jerarquia previamente construida.
+S: libera los arreglos y la estructura.
+R: jerarquia puede ser NULL, no usar despues.
+*/
+void liberarJerarquia(struct JerarquiaContraccion* jerarquia) {
+    if (jerarquia == NULL) {
+        return;
+    }
+    free(jerarquia->rango);
+    free(jerarquia->offsets);
+    free(jerarquia->vecinos);
+    free(jerarquia->pesos);
+    free(jerarquia->medios);
+    free(jerarquia);
+}
@@ -0,0 +1,30 @@
+#ifndef CONTRACCION_H
+#define CONTRACCION_H
+
+#include "grafo.h"
+#include "dijkstra.h"
+
+//jerarquia de contraccion (Contraction Hierarchies) para consultas rapidas sobre un grafo fijo
+//los vertices se contraen uno a uno en orden de importancia; al quitar v se agrega un atajo
+//u-w cuando el unico camino minimo entre sus vecinos pasaba por v. La consulta solo sube
+//de rango desde ambos extremos, asi que explora muy pocos vertices
+struct JerarquiaContraccion {
+    int vertices;
+    int* rango; //orden en que se contrajo cada vertice (mayor = mas importante)
+    //grafo ascendente en adyacencia comprimida: de cada vertice solo salen aristas hacia vecinos de mayor rango
+    int* offsets;
+    int* vecinos;
+    int* pesos;
+    int* medios; //vertice contraido que reemplaza el atajo, o -1 si es una arista original
+    int aristasOriginales; //aristas no dirigidas del grafo de entrada
+    int atajos; //atajos agregados durante la contraccion
+    double segundosPreproceso;
+};
+
+// funciones de la jerarquia de contraccion
+struct JerarquiaContraccion* construirJerarquia(const struct Grafo* grafo);
+struct Camino* caminoJerarquia(const struct JerarquiaContraccion* jerarquia, int inicio, int fin,
+                               struct EspacioBusqueda* ida, struct EspacioBusqueda* vuelta);
+void liberarJerarquia(struct JerarquiaContraccion* jerarquia);
+
+#endif
@@ -0,0 +1,270 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cuadricula.h"
+
+//los vecinos se calculan con desplazamientos de fila/columna sobre maze->cells;
+//el orden arriba, izquierda, derecha, abajo coincide con el de build_graph
+
+/*
+E: laberinto, fila y columna.
+S: retorna 1 si la celda esta dentro del laberinto y no es muro, 0 si no.
+R: laberinto cargado.
+*/
+int grid_is_open(const struct Maze *maze, int row, int col) {
+    if (row < 0 || row >= maze->rows || col < 0 || col >= maze->cols) {
+        return 0;
+    }
+    return maze->cells[row][col] != WALL;
+}
+
+/*
+E: laberinto.
+S: retorna 1 si todas las celdas transitables cuestan 1 (sin celdas de terreno), 0 si no.
+R: laberinto cargado; recorre todas las celdas.
+*/
+int grid_uniform_cost(const struct Maze *maze) {
+    for (int r = 0; r < maze->rows; ++r) {
+        for (int c = 0; c < maze->cols; ++c) {
+            if (cell_cost(maze->cells[r][c]) > 1) {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+/*
+E: laberinto y punteros para las celdas de inicio y meta.
+S: busca I y F en una sola pasada; retorna 0 si encontro ambas, -1 si falta alguna.
+R: laberinto cargado.
+*/
+int grid_find_endpoints(const struct Maze *maze, int *startCell, int *goalCell) {
+    *startCell = -1;
+    *goalCell = -1;
+
+    for (int r = 0; r < maze->rows; ++r) {
+        for (int c = 0; c < maze->cols; ++c) {
+            if (maze->cells[r][c] == START) {
+                *startCell = r * maze->cols + c;
+            } else if (maze->cells[r][c] == END) {
+                *goalCell = r * maze->cols + c;
+            }
+        }
+    }
+
+    if (*startCell == -1 || *goalCell == -1) {
+        printf("Faltan los puntos de inicio (I) y/o meta (F) en el laberinto.\n");
+        return -1;
+    }
+    return 0;
+}
+
+/*
+E: laberinto, indice de celda y arreglo de salida con espacio para 4 indices.
+S: llena out con las celdas vecinas transitables y retorna cuantas son.
+R: celda dentro de [0, rows*cols-1].
+*/
+int grid_neighbors(const struct Maze *maze, int cell, int *out) {
+    //vectores de desplazamiento para los 4 vecinos (arriba, izquierda, derecha, abajo)
+    static const int dr[4] = {-1, 0, 0, 1};
+    static const int dc[4] = {0, -1, 1, 0};
+
+    int row = cell / maze->cols;
+    int col = cell % maze->cols;
+    int count = 0;
+
+    for (int k = 0; k < 4; ++k) {
+        int nr = row + dr[k];
+        int nc = col + dc[k];
+        if (grid_is_open(maze, nr, nc)) {
+            out[count++] = nr * maze->cols + nc;
+        }
+    }
+    return count;
+}
+
+/*
+E: laberinto, celdas inicio y meta, espacio de busqueda con capacidad >= rows*cols.
+S: ejecuta BFS sobre la cuadricula reutilizando el espacio, retorna 1 si encontro goal;
+   espacio->parent conserva el arbol y espacio->orden las celdas visitadas (cantidadOrden).
+R: celdas transitables; el espacio se indexa por celda, no por vertice.
+*/
+int bfs_grid_espacio(const struct Maze *maze, int start, int goal, struct EspacioBusqueda *espacio) {
+    if (espacio == NULL || espacio->capacidad < maze->rows * maze->cols) {
+        return 0;
+    }
+
+    //empezar una consulta nueva: todas las celdas quedan sin visitar en O(1)
+    nuevaConsulta(espacio);
+
+    //el arreglo de orden funciona tambien como cola: lo que ya salio es el orden de visita
+    int *queue = espacio->orden;
+    int head = 0;
+    int tail = 0;
+
+    queue[tail++] = start;
+    espacioMarcarVisitado(espacio, start);
+    espacio->parent[start] = -1;
+
+    while (head < tail) {
+        int v = queue[head++];
+        espacio->cantidadOrden = head;
+
+        if (v == goal) {
+            return 1; //exito
+        }
+
+        //los vecinos se calculan al vuelo, no hay listas de adyacencia
+        int neighbors[4];
+        int count = grid_neighbors(maze, v, neighbors);
+        for (int k = 0; k < count; ++k) {
+            int u = neighbors[k];
+            if (!espacioVisitado(espacio, u)) {
+                espacioMarcarVisitado(espacio, u);
+                espacio->parent[u] = v;
+                queue[tail++] = u;
+            }
+        }
+    }
+
+    return 0; //no se encontro camino
+}
+
+/*
+E: laberinto, celdas inicio y meta, arreglos parent/visitOrder y contador.
+S: ejecuta BFS sobre la cuadricula, llena parent y orden visitado, retorna 1 si encontro goal.
+R: arreglos de tamano rows*cols; celdas transitables; memoria disponible.
+*/
+int bfs_grid(const struct Maze *maze, int start, int goal, int *parent, int *visitOrder, int *visitCount) {
+    int cells = maze->rows * maze->cols;
+
+    //espacio temporal; para consultas repetidas conviene reutilizar uno con bfs_grid_espacio
+    struct EspacioBusqueda *espacio = crearEspacioBusqueda(cells);
+    if (espacio == NULL) {
+        printf("No se pudo reservar memoria para BFS.\n");
+        return 0;
+    }
+
+    int found = bfs_grid_espacio(maze, start, goal, espacio);
+
+    //copiar los resultados a los arreglos del llamador (-1 = sin padre)
+    for (int i = 0; i < cells; ++i) {
+        parent[i] = espacioVisitado(espacio, i) ? espacio->parent[i] : -1;
+    }
+    for (int i = 0; i < espacio->cantidadOrden; ++i) {
+        visitOrder[i] = espacio->orden[i];
+    }
+    *visitCount = espacio->cantidadOrden;
+
+    liberarEspacioBusqueda(espacio);
+    return found;
+}
+
+/*
+Calcula el camino mas corto entre dos celdas con Dijkstra sobre la cuadricula implicita.
+E: laberinto, celdas inicio y fin.
+S: retorna Camino con indices de celda (fila * cols + col) o NULL si no hay ruta/error.
+R: celdas transitables dentro del laberinto; cada movimiento cuesta el costo de la celda destino.
+*/
+struct Camino* dijkstra_grid(const struct Maze *maze, int inicio, int fin) {
+    return dijkstra_grid_con_opciones(maze, inicio, fin, NULL);
+}
+
+/*
+Igual que dijkstra_grid, pero permite elegir la cola de prioridad y registrar sus operaciones.
+E: laberinto, celdas inicio y fin, opciones (NULL = heap binario sin traza).
+S: retorna Camino con indices de celda o NULL si no hay ruta/error.
+R: celdas transitables dentro del laberinto; cada movimiento cuesta el costo de la celda destino.
+*/
+struct Camino* dijkstra_grid_con_opciones(const struct Maze *maze, int inicio, int fin, const struct OpcionesDijkstra* opciones) {
+    if (maze == NULL || maze->rows <= 0 || maze->cols <= 0) {
+        return NULL;
+    }
+
+    //espacio temporal; para consultas repetidas conviene reutilizar uno con dijkstra_grid_con_espacio
+    struct EspacioBusqueda* espacio = crearEspacioBusqueda(maze->rows * maze->cols);
+    if (espacio == NULL) {
+        return NULL;
+    }
+    struct Camino* camino = dijkstra_grid_con_espacio(maze, inicio, fin, opciones, espacio);
+    liberarEspacioBusqueda(espacio);
+    return camino;
+}
+
+/*
+Dijkstra sobre la cuadricula sin reservar memoria por consulta: usa los arreglos y la cola del espacio.
+E: laberinto, celdas inicio y fin, opciones (NULL = heap binario sin traza), espacio de busqueda.
+S: retorna Camino con indices de celda o NULL si no hay ruta/error; espacio->parent conserva el arbol.
+R: espacio con capacidad >= rows*cols; cada movimiento cuesta el costo de la celda destino.
+*/
+struct Camino* dijkstra_grid_con_espacio(const struct Maze *maze, int inicio, int fin, const struct OpcionesDijkstra* opciones, struct EspacioBusqueda* espacio) {
+    if (maze == NULL || maze->rows <= 0 || maze->cols <= 0) {
+        return NULL;
+    }
+    int n = maze->rows * maze->cols;
+    if (inicio < 0 || fin < 0 || inicio >= n || fin >= n || espacio == NULL || espacio->capacidad < n) {
+        return NULL;
+    }
+
+    //los valores pendientes nunca superan minimo + MAX_CELL_COST
+    enum TipoCola tipoCola = (opciones != NULL) ? opciones->tipoCola : COLA_HEAP_BINARIO;
+    struct ColaPrioridad* cola = colaDeEspacio(espacio, tipoCola, MAX_CELL_COST);
+    if (cola == NULL) {
+        return NULL;
+    }
+    cola->traza = (opciones != NULL) ? opciones->traza : NULL;
+    if (cola->traza != NULL) {
+        cola->traza->vertices = n;
+        cola->traza->rango = MAX_CELL_COST;
+    }
+
+    nuevaConsulta(espacio);
+    espacioAsignarValor(espacio, inicio, 0);
+    espacio->parent[inicio] = -1;
+    insertarCola(cola, inicio, 0);
+
+    int expandidos = 0;
+    while (cola->tamano > 0) {
+        struct NodoPrioridad actual = extraerMinimo(cola);
+        int v = actual.vertice;
+        if (v == -1) {
+            break;
+        }
+        if (espacioVisitado(espacio, v)) {
+            continue;
+        }
+        espacioMarcarVisitado(espacio, v);
+        expandidos++;
+
+        if (v == fin) {
+            break;
+        }
+
+        int valV = espacio->val[v];
+        int vecinos[4];
+        int count = grid_neighbors(maze, v, vecinos);
+        for (int k = 0; k < count; ++k) {
+            int u = vecinos[k];
+            if (espacioVisitado(espacio, u)) {
+                continue;
+            }
+            int nuevoVal = valV + cell_cost(maze->cells[u / maze->cols][u % maze->cols]);
+            if (!espacioTieneValor(espacio, u) || nuevoVal < espacio->val[u]) {
+                espacioAsignarValor(espacio, u, nuevoVal);
+                espacio->parent[u] = v;
+                insertarCola(cola, u, nuevoVal);
+            }
+        }
+    }
+    cola->traza = NULL;
+
+    struct Camino* camino = NULL;
+    if (espacioVisitado(espacio, fin)) {
+        camino = reconstruirCamino(espacio->parent, inicio, fin, espacio->val[fin], n);
+        if (camino != NULL) {
+            camino->expandidos = expandidos;
+        }
+    }
+    return camino;
+}
@@ -0,0 +1,20 @@
+#ifndef CUADRICULA_H
+#define CUADRICULA_H
+
+#include "laberinto.h"
+#include "dijkstra.h"
+
+//busquedas implicitas sobre las celdas del laberinto, sin construir el grafo
+//cada celda se identifica por su indice lineal fila * cols + col
+
+int grid_is_open(const struct Maze *maze, int row, int col);
+int grid_uniform_cost(const struct Maze *maze);
+int grid_find_endpoints(const struct Maze *maze, int *startCell, int *goalCell);
+int grid_neighbors(const struct Maze *maze, int cell, int *out);
+int bfs_grid(const struct Maze *maze, int start, int goal, int *parent, int *visitOrder, int *visitCount);
+int bfs_grid_espacio(const struct Maze *maze, int start, int goal, struct EspacioBusqueda *espacio);
+struct Camino* dijkstra_grid(const struct Maze *maze, int inicio, int fin);
+struct Camino* dijkstra_grid_con_opciones(const struct Maze *maze, int inicio, int fin, const struct OpcionesDijkstra* opciones);
+struct Camino* dijkstra_grid_con_espacio(const struct Maze *maze, int inicio, int fin, const struct OpcionesDijkstra* opciones, struct EspacioBusqueda* espacio);
+
+#endif
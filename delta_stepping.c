@@ -0,0 +1,345 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "delta_stepping.h"
+#include "lote.h" //hilosDisponibles
+
+//vertices de la frontera que un hilo toma de una vez
+#define DELTA_BLOQUE_FRONTERA 64
+
+//distancia desconocida en la mitad alta del estado empaquetado
+#define DELTA_INF UINT32_MAX
+
+//la distancia y el padre de cada vertice viven juntos en un entero de 64 bits
+//(distancia en la mitad alta, padre en la baja), asi un solo compare-and-swap los cambia a la vez
+//y nunca queda un padre que no corresponde a la distancia
+
+//lista de vertices que solo usa un hilo
+struct ListaDelta {
+    int* datos;
+    int cantidad;
+    int capacidad;
+};
+
+//listas propias de cada hilo: una por cubeta del arreglo circular y los vertices asentados
+//en la cubeta actual (para relajar sus aristas pesadas al vaciarla)
+struct HiloDelta {
+    struct ListaDelta* cubetas;
+    struct ListaDelta asentados;
+};
+
+//datos compartidos por los hilos de una ejecucion (el grafo solo se lee)
+struct TrabajoDelta {
+    const struct Grafo* grafo;
+    int delta;
+    int numCubetas; //cubetas del arreglo circular: pesoMaximo / delta + 2 bastan
+    _Atomic uint64_t* estado; //distancia y padre empaquetados por vertice
+    atomic_uint* fase; //ultima fase en la que cada vertice entro a la frontera
+    int* frontera; //vertices de la cubeta actual en la fase actual
+    atomic_int tamFrontera;
+    atomic_int tomados; //vertices de la frontera que ya tomo algun hilo
+    atomic_int sinMemoria; //1 si algun hilo no pudo crecer sus listas
+    atomic_int siguienteId; //indice para las listas propias de cada hilo
+    struct HiloDelta* porHilo;
+    int actual; //cubeta en proceso (distancias en [actual * delta, (actual + 1) * delta))
+    unsigned int faseActual;
+    int terminado; //lo escribe un solo hilo entre las barreras de cada fase
+    pthread_barrier_t barrera;
+    pthread_mutex_t candado; //protege la puerta de arranque
+    pthread_cond_t arranque;
+    int listo; //1 cuando la barrera ya esta inicializada
+};
+
+static inline uint64_t empaquetar(uint32_t distancia, int padre) {
+    return ((uint64_t)distancia << 32) | (uint32_t)padre;
+}
+
+static inline uint32_t distanciaDe(uint64_t estado) {
+    return (uint32_t)(estado >> 32);
+}
+
+/*
+E: lista propia de un hilo y vertice.
+S: agrega el vertice al final; retorna 0 o -1 si falta memoria.
+R: ninguna.
+*/
+static int agregarListaDelta(struct ListaDelta* lista, int v) {
+    if (lista->cantidad == lista->capacidad) {
+        int nuevaCapacidad = lista->capacidad > 0 ? lista->capacidad * 2 : 64;
+        int* nuevos = realloc(lista->datos, (size_t)nuevaCapacidad * sizeof(int));
+        if (nuevos == NULL) {
+            return -1;
+        }
+        lista->datos = nuevos;
+        lista->capacidad = nuevaCapacidad;
+    }
+    lista->datos[lista->cantidad++] = v;
+    return 0;
+}
+
+/*
+E: trabajo, listas del hilo, vertice u, distancia candidata y padre.
+S: baja la distancia de u con compare-and-swap si la candidata es menor y, en ese caso,
+   lo agrega a la cubeta que le corresponde.
+R: la candidata no supera la distancia maxima representable.
+*/
+static void relajarDelta(struct TrabajoDelta* trabajo, struct HiloDelta* propio, int u, uint32_t distancia, int padre) {
+    uint64_t viejo = atomic_load_explicit(&trabajo->estado[u], memory_order_relaxed);
+    uint64_t nuevo = empaquetar(distancia, padre);
+    while (distancia < distanciaDe(viejo)) {
+        if (atomic_compare_exchange_weak_explicit(&trabajo->estado[u], &viejo, nuevo, memory_order_relaxed, memory_order_relaxed)) {
+            int ranura = (int)((distancia / (uint32_t)trabajo->delta) % (uint32_t)trabajo->numCubetas);
+            if (agregarListaDelta(&propio->cubetas[ranura], u) != 0) {
+                atomic_store(&trabajo->sinMemoria, 1);
+            }
+            return;
+        }
+    }
+}
+
+/*
+E: trabajo, listas del hilo, vertice v y bandera ligeras (1 = peso <= delta, 0 = peso > delta).
+S: relaja las aristas de v de ese tipo con la distancia actual de v.
+R: v alcanzado.
+*/
+static void relajarAristasDelta(struct TrabajoDelta* trabajo, struct HiloDelta* propio, int v, int ligeras) {
+    const struct Grafo* grafo = trabajo->grafo;
+    uint64_t distanciaV = distanciaDe(atomic_load_explicit(&trabajo->estado[v], memory_order_relaxed));
+    for (int e = grafo->offsets[v]; e < grafo->offsets[v + 1]; ++e) {
+        int peso = grafo->pesos[e];
+        if (peso <= 0 || (peso <= trabajo->delta) != ligeras) {
+            continue;
+        }
+        uint64_t candidata = distanciaV + (uint64_t)peso;
+        if (candidata < DELTA_INF) {
+            relajarDelta(trabajo, propio, grafo->vecinos[e], (uint32_t)candidata, v);
+        }
+    }
+}
+
+/*
+E: puntero a TrabajoDelta.
+S: procesa fases hasta que no quedan cubetas: arma la frontera con las listas de todos los hilos,
+   relaja aristas ligeras mientras la cubeta se vuelva a llenar, y al vaciarla relaja las pesadas.
+R: todos los hilos pasan por las mismas barreras en cada fase.
+*/
+static void* trabajadorDelta(void* arg) {
+    struct TrabajoDelta* trabajo = arg;
+    struct HiloDelta* propio = &trabajo->porHilo[atomic_fetch_add(&trabajo->siguienteId, 1)];
+
+    pthread_mutex_lock(&trabajo->candado);
+    while (!trabajo->listo) {
+        pthread_cond_wait(&trabajo->arranque, &trabajo->candado);
+    }
+    pthread_mutex_unlock(&trabajo->candado);
+
+    while (1) {
+        //1) cada hilo filtra su lista de la cubeta actual (entradas viejas y repetidas) y la copia a la frontera
+        struct ListaDelta* lista = &propio->cubetas[trabajo->actual % trabajo->numCubetas];
+        int validos = 0;
+        for (int i = 0; i < lista->cantidad; ++i) {
+            int v = lista->datos[i];
+            uint32_t distancia = distanciaDe(atomic_load_explicit(&trabajo->estado[v], memory_order_relaxed));
+            if ((int)(distancia / (uint32_t)trabajo->delta) != trabajo->actual) {
+                continue; //su distancia bajo a otra cubeta despues de agregarlo
+            }
+            if (atomic_exchange_explicit(&trabajo->fase[v], trabajo->faseActual, memory_order_relaxed) == trabajo->faseActual) {
+                continue; //ya esta en la frontera de esta fase
+            }
+            lista->datos[validos++] = v;
+        }
+        if (validos > 0) {
+            int desde = atomic_fetch_add(&trabajo->tamFrontera, validos);
+            memcpy(&trabajo->frontera[desde], lista->datos, (size_t)validos * sizeof(int));
+        }
+        lista->cantidad = 0;
+        pthread_barrier_wait(&trabajo->barrera);
+
+        //2) expandir la frontera; si quedo vacia la cubeta termino y tocan las aristas pesadas
+        int tamFrontera = atomic_load(&trabajo->tamFrontera);
+        if (tamFrontera > 0) {
+            while (1) {
+                int desde = atomic_fetch_add(&trabajo->tomados, DELTA_BLOQUE_FRONTERA);
+                if (desde >= tamFrontera) {
+                    break;
+                }
+                int hasta = desde + DELTA_BLOQUE_FRONTERA < tamFrontera ? desde + DELTA_BLOQUE_FRONTERA : tamFrontera;
+                for (int i = desde; i < hasta; ++i) {
+                    int v = trabajo->frontera[i];
+                    if (agregarListaDelta(&propio->asentados, v) != 0) {
+                        atomic_store(&trabajo->sinMemoria, 1);
+                    }
+                    relajarAristasDelta(trabajo, propio, v, 1);
+                }
+            }
+        } else {
+            for (int i = 0; i < propio->asentados.cantidad; ++i) {
+                relajarAristasDelta(trabajo, propio, propio->asentados.datos[i], 0);
+            }
+            propio->asentados.cantidad = 0;
+        }
+
+        //3) un solo hilo prepara la siguiente fase mientras los demas esperan
+        if (pthread_barrier_wait(&trabajo->barrera) == PTHREAD_BARRIER_SERIAL_THREAD) {
+            if (tamFrontera == 0) {
+                //buscar la siguiente cubeta con algo en cualquier hilo; todas las distancias
+                //pendientes caen a menos de numCubetas cubetas de la actual
+                int siguiente = -1;
+                int hilos = atomic_load(&trabajo->siguienteId);
+                for (int k = 1; k < trabajo->numCubetas && siguiente == -1; ++k) {
+                    int ranura = (trabajo->actual + k) % trabajo->numCubetas;
+                    for (int h = 0; h < hilos; ++h) {
+                        if (trabajo->porHilo[h].cubetas[ranura].cantidad > 0) {
+                            siguiente = trabajo->actual + k;
+                            break;
+                        }
+                    }
+                }
+                trabajo->terminado = siguiente == -1 || atomic_load(&trabajo->sinMemoria);
+                trabajo->actual = siguiente;
+            }
+            trabajo->faseActual++;
+            atomic_store(&trabajo->tamFrontera, 0);
+            atomic_store(&trabajo->tomados, 0);
+        }
+        pthread_barrier_wait(&trabajo->barrera);
+        if (trabajo->terminado) {
+            break;
+        }
+    }
+    return NULL;
+}
+
+/*
+E: grafo.
+S: ancho de cubeta sugerido: peso maximo entre el grado promedio (al menos 1), para que cada
+   cubeta tenga trabajo suficiente sin reprocesar demasiados vertices.
+R: invariantes del grafo al dia.
+*/
+int deltaSugerido(const struct Grafo* grafo) {
+    if (grafo == NULL || grafo->vertices <= 0 || grafo->entradas <= 0) {
+        return 1;
+    }
+    long long delta = (long long)grafo->pesoMaximo * grafo->vertices / grafo->entradas;
+    return delta > 0 ? (int)delta : 1;
+}
+
+/*
+Calcula la distancia minima desde un vertice hacia todos los demas repartiendo cada cubeta entre hilos.
+E: grafo con pesos no negativos, vertice origen, ancho de cubeta (<= 0 = deltaSugerido), hilos
+   (<= 0 = todos los nucleos), arreglos dist y parent de tamano vertices (parent puede ser NULL).
+S: llena dist como dijkstraDistancias (-1 = inalcanzable) y parent con un arbol de caminos minimos
+   (dist[parent[v]] + peso = dist[v]); retorna cuantos vertices se alcanzaron, o -1 en error.
+R: el grafo no se modifica durante la llamada; distancias menores a 2^32 - 1.
+*/
+int deltaStepping(const struct Grafo* grafo, int origen, int delta, int hilos, int* dist, int* parent) {
+    if (grafo == NULL || dist == NULL || grafo->vertices <= 0 || origen < 0 || origen >= grafo->vertices || !grafo->pesosNoNegativos) {
+        return -1;
+    }
+    int n = grafo->vertices;
+    if (delta <= 0) {
+        delta = deltaSugerido(grafo);
+    }
+    if (hilos <= 0) {
+        hilos = hilosDisponibles();
+    }
+
+    struct TrabajoDelta trabajo;
+    memset(&trabajo, 0, sizeof(trabajo));
+    trabajo.grafo = grafo;
+    trabajo.delta = delta;
+    trabajo.numCubetas = (grafo->pesoMaximo > 0 ? grafo->pesoMaximo : 1) / delta + 2;
+    trabajo.estado = malloc((size_t)n * sizeof(_Atomic uint64_t));
+    trabajo.fase = malloc((size_t)n * sizeof(atomic_uint));
+    trabajo.frontera = malloc((size_t)n * sizeof(int));
+    trabajo.porHilo = calloc((size_t)hilos, sizeof(struct HiloDelta));
+    pthread_t* ids = malloc((size_t)hilos * sizeof(pthread_t));
+    int error = trabajo.estado == NULL || trabajo.fase == NULL || trabajo.frontera == NULL || trabajo.porHilo == NULL || ids == NULL;
+    for (int h = 0; h < hilos && !error; ++h) {
+        trabajo.porHilo[h].cubetas = calloc((size_t)trabajo.numCubetas, sizeof(struct ListaDelta));
+        error = trabajo.porHilo[h].cubetas == NULL;
+    }
+
+    int alcanzados = -1;
+    if (!error) {
+        for (int i = 0; i < n; ++i) {
+            atomic_init(&trabajo.estado[i], empaquetar(DELTA_INF, -1));
+            atomic_init(&trabajo.fase[i], 0);
+        }
+        atomic_init(&trabajo.estado[origen], empaquetar(0, -1));
+        atomic_init(&trabajo.tamFrontera, 0);
+        atomic_init(&trabajo.tomados, 0);
+        atomic_init(&trabajo.sinMemoria, 0);
+        atomic_init(&trabajo.siguienteId, 0);
+        trabajo.actual = 0;
+        trabajo.faseActual = 1;
+        error = agregarListaDelta(&trabajo.porHilo[0].cubetas[0], origen) != 0;
+    }
+
+    if (!error) {
+        //los hilos esperan en la puerta de arranque hasta que se sabe cuantos se crearon,
+        //porque la barrera de cada fase necesita exactamente esa cantidad
+        pthread_mutex_init(&trabajo.candado, NULL);
+        pthread_cond_init(&trabajo.arranque, NULL);
+        pthread_mutex_lock(&trabajo.candado);
+        int creados = 0;
+        for (int h = 1; h < hilos; ++h) {
+            if (pthread_create(&ids[creados], NULL, trabajadorDelta, &trabajo) != 0) {
+                break; //seguir con los hilos que si se crearon
+            }
+            creados++;
+        }
+        pthread_barrier_init(&trabajo.barrera, NULL, (unsigned)(creados + 1));
+        trabajo.listo = 1;
+        pthread_cond_broadcast(&trabajo.arranque);
+        pthread_mutex_unlock(&trabajo.candado);
+
+        trabajadorDelta(&trabajo);
+        for (int h = 0; h < creados; ++h) {
+            pthread_join(ids[h], NULL);
+        }
+        pthread_barrier_destroy(&trabajo.barrera);
+        pthread_mutex_destroy(&trabajo.candado);
+        pthread_cond_destroy(&trabajo.arranque);
+
+        //desempaquetar distancia y padre
+        if (!atomic_load(&trabajo.sinMemoria)) {
+            alcanzados = 0;
+            for (int i = 0; i < n; ++i) {
+                uint64_t estado = atomic_load_explicit(&trabajo.estado[i], memory_order_relaxed);
+                uint32_t distancia = distanciaDe(estado);
+                dist[i] = distancia == DELTA_INF ? -1 : (int)distancia;
+                if (parent != NULL) {
+                    parent[i] = (int)(uint32_t)estado;
+                }
+                if (distancia != DELTA_INF) {
+                    alcanzados++;
+                }
+            }
+        }
+    }
+
+    if (trabajo.porHilo != NULL) {
+        for (int h = 0; h < hilos; ++h) {
+            if (trabajo.porHilo[h].cubetas != NULL) {
+                for (int c = 0; c < trabajo.numCubetas; ++c) {
+                    free(trabajo.porHilo[h].cubetas[c].datos);
+                }
+            }
+            free(trabajo.porHilo[h].cubetas);
+            free(trabajo.porHilo[h].asentados.datos);
+        }
+    }
+    free(trabajo.porHilo);
+    free(trabajo.estado);
+    free(trabajo.fase);
+    free(trabajo.frontera);
+    free(ids);
+    return alcanzados;
+}
@@ -0,0 +1,12 @@
+#ifndef DELTA_STEPPING_H
+#define DELTA_STEPPING_H
+
+#include "grafo.h"
+
+//caminos minimos desde un origen con delta-stepping: los vertices se agrupan en cubetas de ancho
+//delta segun su distancia, y todos los vertices de una cubeta se expanden a la vez entre varios hilos
+//(primero las aristas ligeras, peso <= delta, que pueden volver a la misma cubeta; al vaciarla, las pesadas)
+int deltaStepping(const struct Grafo* grafo, int origen, int delta, int hilos, int* dist, int* parent);
+int deltaSugerido(const struct Grafo* grafo);
+
+#endif
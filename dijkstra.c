@@ -3,269 +3,39 @@
 #include <stdlib.h>
 
 #include "dijkstra.h"
-#include "visualizacion.h"
-
-//FUNCIONES PARA EL HEAP (COLA DE PRIORIDAD)
-
-/*
-E: cola de prioridad y dos indices validos dentro del heap
-S: void (intercambia elementos y actualiza posiciones)
-R: cola no nula; indices menores al tamano
-*/
-static void intercambiar(struct ColaPrioridad* cola, int i, int j) {
-    //validar restricciones
-    if (cola == NULL || i < 0 || j < 0 || i >= cola->tamano || j >= cola->tamano) {
-        return;
-    }
-
-    //intercambia los elementos en las posiciones i y j del heap
-    struct NodoPrioridad tmp = cola->heap[i];
-    cola->heap[i] = cola->heap[j];
-    cola->heap[j] = tmp;
-
-    //actualiza posiciones
-    cola->posiciones[cola->heap[i].vertice] = i;
-    cola->posiciones[cola->heap[j].vertice] = j;
-}
-
-/*
-E: cola y posicion de un elemento ya insertado
-S: sube el elemento hasta restaurar propiedad de min-heap
-R: cola existe, indice en rango
-*/
-static void subir(struct ColaPrioridad* cola, int idx) {
-    //validar restricciones
-    if (cola == NULL || idx < 0 || idx >= cola->tamano) {
-        return;
-    }
-
-    //sube el elemento mientras su valor sea menor que el de su padre
-    while (idx > 0) {
-        int padre = (idx - 1) / 2; //calcular el indice del padre
-        
-        //si el padre ya tiene un valor menor o igual, la propiedad del heap se cumple
-        if (cola->heap[padre].valor <= cola->heap[idx].valor) {
-            break;
-        }
-        
-        //intercambiar con el padre y seguir subiendo
-        intercambiar(cola, padre, idx);
-        idx = padre;
-    }
-}
-
-/*
-E: cola y posicion de un elemento ya insertado
-S: baja el elemento hasta restaurar propiedad de min-heap
-R: cola existe, indice en rango
-*/
-static void bajar(struct ColaPrioridad* cola, int idx) {
-    //validar restricciones
-    if (cola == NULL || idx < 0 || idx >= cola->tamano) {
-        return;
-    }
-
-    //baja el elemento mientras tenga un hijo con valor menor
-    while (1) {
-        int izquierdo = 2 * idx + 1; //calcular indice del hijo izquierdo
-        int derecho = 2 * idx + 2;   //calcular indice del hijo derecho
-        int menor = idx; //asumimos que el actual es el menor
-
-        //verificar si el hijo izquierdo existe y tiene un valor menor
-        if (izquierdo < cola->tamano && cola->heap[izquierdo].valor < cola->heap[menor].valor) {
-            menor = izquierdo;
-        }
-        
-        //verificar si el hijo derecho existe y tiene un valor aun menor
-        if (derecho < cola->tamano && cola->heap[derecho].valor < cola->heap[menor].valor) {
-            menor = derecho;
-        }
-        
-        //si el elemento actual ya es el menor, la propiedad del heap se cumple
-        if (menor == idx) {
-            break;
-        }
-        
-        //intercambiar con el hijo menor y seguir bajando
-        intercambiar(cola, idx, menor);
-        idx = menor;
-    }
-}
-
-/*
-E: capacidad maxima del heap
-S: puntero a cola inicializada con posiciones en -1 o NULL en error
-R: memoria disponible; capacidad mayor a 0
-*/
-struct ColaPrioridad* crearColaPrioridad(int capacidad) {
-    //validaciones
-    if (capacidad <= 0) {
-        return NULL;
-    }
-
-    //reservar memoria para la estructura principal de la cola
-    struct ColaPrioridad* cola = calloc(1, sizeof(struct ColaPrioridad));
-    if (cola == NULL) {
-        return NULL;
-    }
-
-    //reservar memoria para el heap (arreglo de nodos con prioridad)
-    cola->heap = calloc(capacidad, sizeof(struct NodoPrioridad));
-    
-    //reservar memoria para el arreglo que rastrea donde esta cada vertice en el heap
-    cola->posiciones = calloc(capacidad, sizeof(int));
-
-    //si fallo alguna asignacion de memoria, liberar todo y retornar NULL
-    if (cola->heap == NULL || cola->posiciones == NULL) {
-        free(cola->heap);
-        free(cola->posiciones);
-        free(cola);
-        return NULL;
-    }
-
-    //inicializar todas las posiciones en -1 (indica que el vertice no esta en el heap)
-    for (int i = 0; i < capacidad; ++i) {
-        cola->posiciones[i] = -1;
-    }
-    
-    //establecer la capacidad maxima y el tamano inicial en 0
-    cola->capacidad = capacidad;
-    cola->tamano = 0;
-    return cola;
-}
-
-/*
-E: cola valida, vertice y nuevo valor
-S: inserta vertice si no existe; si existe y valor mejora, actualiza prioridad
-R: cola con espacio suficiente; vertice dentro de rango [0, capacidad-1]
-*/
-void insertarCola(struct ColaPrioridad* cola, int vertice, int valor) {
-    //validar restricciones
-    if (cola == NULL || vertice < 0 || vertice >= cola->capacidad) {
-        return;
-    }
-
-    //obtener la posicion actual del vertice en el heap
-    int pos = cola->posiciones[vertice];
-    
-    //si el vertice ya esta en el heap
-    if (pos != -1) {
-        //solo actualizar si el nuevo valor es menor (mejora el camino)
-        if (valor < cola->heap[pos].valor) {
-            cola->heap[pos].valor = valor; //actualizar el valor
-            subir(cola, pos); //restaurar la propiedad del heap subiendo el elemento
-        }
-        return;
-    }
-
-    //verificar que haya espacio en el heap
-    if (cola->tamano >= cola->capacidad) {
-        return; // sin espacio; no deberia ocurrir si se usa bien
-    }
-
-    //insertar el nuevo vertice al final del heap
-    int idx = cola->tamano++;
-    cola->heap[idx].vertice = vertice;
-    cola->heap[idx].valor = valor;
-    cola->posiciones[vertice] = idx; //registrar donde esta el vertice
-    
-    //subir el elemento para mantener la propiedad de min-heap
-    subir(cola, idx);
-}
-
-/*
-E: cola no vacia.
-S: extrae y retorna el elemento con menor valor; si esta vacia, vertice=-1.
-R: heap existe; actualizar posiciones.
-*/
-struct NodoPrioridad extraerMinimo(struct ColaPrioridad* cola) {
-    //nodo nulo para retornar en caso de error
-    struct NodoPrioridad nulo = {-1, -1};
-    
-    //validar restricciones
-    if (cola == NULL || cola->tamano == 0) {
-        return nulo;
-    }
-
-    //guardar el elemento de la raiz (el de menor valor)
-    struct NodoPrioridad raiz = cola->heap[0];
-    
-    //marcar que este vertice ya no esta en el heap
-    cola->posiciones[raiz.vertice] = -1;
-
-    //reducir el tamano del heap
-    cola->tamano--;
-    
-    //si todavia quedan elementos en el heap
-    if (cola->tamano > 0) {
-        //mover el ultimo elemento a la raiz
-        cola->heap[0] = cola->heap[cola->tamano];
-        cola->posiciones[cola->heap[0].vertice] = 0; //actualizar su posicion
-        
-        //bajar este elemento para restaurar la propiedad de min-heap
-        bajar(cola, 0);
-    }
-
-    return raiz;
-}
-
-/*
-E: cola previamente creada.
-S: libera memoria de heap, posiciones y la estructura.
-R: cola puede ser NULL, no usar despues.
-*/
-void liberarColaPrioridad(struct ColaPrioridad* cola) {
-    if (cola == NULL) {
-        return;
-    }
-    //liberar el arreglo del heap
-    free(cola->heap);
-    //liberar el arreglo de posiciones
-    free(cola->posiciones);
-    //liberar la estructura principal
-    free(cola);
-}
+#include "bfs.h"
 
 /*
 E: arreglo de padres, indices inicio y fin, valor final y numero de vertices.
 S: construye estructura Camino con nodos en orden y valor total.
 R: parent tiene una cadena valida hasta inicio, memoria disponible.
 .*/
-static struct Camino* reconstruirCamino(const int* parent, int inicio, int fin, int valorFin, int vertices) {
+struct Camino* reconstruirCamino(const int* parent, int inicio, int fin, int valorFin, int vertices) {
     //validar restricciones
     if (parent == NULL || vertices <= 0 || inicio < 0 || fin < 0 || inicio >= vertices || fin >= vertices) {
         return NULL;
     }
 
-    //usar una pila temporal para guardar el camino (se guarda al reves)
-    int* pila = calloc(vertices, sizeof(int));
-    if (pila == NULL) {
-        return NULL;
-    }
-
-    //reconstruir el camino desde fin hasta inicio usando el arreglo de padres
+    //primera pasada: medir el camino desde fin hasta inicio usando el arreglo de padres
+    //(asi solo se reserva el tamano del camino, no el del grafo)
     int len = 0;
     int v = fin;
     while (v != -1 && len < vertices) {
-        pila[len++] = v; //agregar el vertice actual a la pila
-        
+        len++;
         if (v == inicio) {
             break; //llegamos al inicio, terminar
         }
-        
         v = parent[v]; //moverse al padre
     }
 
     //si no llegamos al inicio, no hay camino valido
-    if (v == -1) {
-        free(pila);
+    if (v != inicio) {
         return NULL; // sin camino
     }
 
     //crear la estructura Camino para retornar
     struct Camino* camino = calloc(1, sizeof(struct Camino));
     if (camino == NULL) {
-        free(pila);
         return NULL;
     }
     
@@ -277,16 +47,32 @@ static struct Camino* reconstruirCamino(const int* parent, int inicio, int fin,
     camino->nodos = calloc(len, sizeof(int));
     if (camino->nodos == NULL) {
         free(camino);
-        free(pila);
         return NULL;
     }
 
-    //invertir la pila para obtener el orden correcto: inicio ... fin
-    for (int i = 0; i < len; ++i) {
-        camino->nodos[i] = pila[len - 1 - i];
+    //segunda pasada: llenar de atras hacia adelante para obtener el orden inicio ... fin
+    v = fin;
+    for (int i = len - 1; i >= 0; --i) {
+        camino->nodos[i] = v;
+        v = parent[v];
     }
+    return camino;
+}
 
-    free(pila);
+/*
+E: grafo con todas sus aristas activas de peso 1, indices inicio y fin validos, espacio de busqueda.
+S: retorna el Camino minimo encontrado con BFS o NULL si no hay ruta/error.
+R: grafoPesosUnitarios(grafo) debe ser verdadero.
+*/
+static struct Camino* caminoPesosUnitarios(const struct Grafo* grafo, int inicio, int fin, struct EspacioBusqueda* espacio) {
+    struct Camino* camino = NULL;
+    if (bfs_espacio(grafo, inicio, fin, espacio)) {
+        camino = reconstruirCamino(espacio->parent, inicio, fin, 0, grafo->vertices);
+        if (camino != NULL) {
+            camino->valorTotal = camino->longitud - 1; //cada arista vale 1
+            camino->expandidos = espacio->cantidadOrden;
+        }
+    }
     return camino;
 }
 
@@ -294,63 +80,93 @@ static struct Camino* reconstruirCamino(const int* parent, int inicio, int fin,
 Calcula el camino mas corto entre dos nodos usando el algoritmo de Dijkstra.
 E: grafo con pesos no negativos, indices inicio y fin validos.
 S: retorna puntero a Camino minimo o NULL si no hay ruta/error.
-R: grafo->peso cuadrada, memoria disponible; pesos >=0.
+R: grafo con adyacencia comprimida e invariantes al dia, memoria disponible; pesos >=0.
 */
 struct Camino* dijkstra(struct Grafo* grafo, int inicio, int fin) {
+    struct OpcionesDijkstra opciones = {COLA_HEAP_BINARIO, NULL, {NULL, NULL}};
+    return dijkstraConOpciones(grafo, inicio, fin, &opciones);
+}
+
+/*
+Igual que dijkstra, pero permite elegir la cola de prioridad en tiempo de ejecucion.
+E: grafo con pesos no negativos, indices inicio y fin validos, opciones (NULL = por defecto).
+S: retorna puntero a Camino minimo o NULL si no hay ruta/error.
+R: grafo con adyacencia comprimida e invariantes al dia, memoria disponible; pesos >=0.
+*/
+struct Camino* dijkstraConOpciones(struct Grafo* grafo, int inicio, int fin, const struct OpcionesDijkstra* opciones) {
+    if (grafo == NULL || grafo->vertices <= 0) {
+        return NULL;
+    }
+
+    //espacio temporal; para consultas repetidas conviene reutilizar uno con dijkstraConEspacio
+    struct EspacioBusqueda* espacio = crearEspacioBusqueda(grafo->vertices);
+    if (espacio == NULL) {
+        return NULL;
+    }
+    struct Camino* camino = dijkstraConEspacio(grafo, inicio, fin, opciones, espacio);
+    liberarEspacioBusqueda(espacio);
+    return camino;
+}
+
+/*
+Dijkstra sin reservar memoria por consulta: usa los arreglos y la cola del espacio.
+E: grafo con pesos no negativos, indices inicio y fin validos, opciones (NULL = por defecto), espacio de busqueda.
+S: retorna puntero a Camino minimo o NULL si no hay ruta/error; espacio->parent conserva el arbol de la consulta.
+R: espacio con capacidad >= vertices; invariantes del grafo al dia; pesos >=0.
+*/
+struct Camino* dijkstraConEspacio(const struct Grafo* grafo, int inicio, int fin, const struct OpcionesDijkstra* opciones, struct EspacioBusqueda* espacio) {
     //validar restricciones basicas
-    if (grafo == NULL || grafo->vertices <= 0 || grafo->peso == NULL) {
+    if (grafo == NULL || grafo->vertices <= 0 || grafo->offsets == NULL || grafo->vecinos == NULL || grafo->pesos == NULL) {
         return NULL;
     }
     int n = grafo->vertices;
-    if (inicio < 0 || fin < 0 || inicio >= n || fin >= n) {
+    if (inicio < 0 || fin < 0 || inicio >= n || fin >= n || espacio == NULL || espacio->capacidad < n) {
         return NULL;
     }
 
-    //validar que grafo->peso sea una matriz cuadrada valida y pesos no negativos
-    for (int i = 0; i < n; ++i) {
-        if (grafo->peso[i] == NULL) {
-            return NULL;
-        }
-        for (int j = 0; j < n; ++j) {
-            if (grafo->peso[i][j] < 0) {
-                return NULL; //pesos negativos no permitidos
-            }
-        }
+    //validar que los pesos sean no negativos: el grafo mantiene este invariante, consulta O(1)
+    if (!grafo->pesosNoNegativos) {
+        return NULL; //pesos negativos no permitidos
     }
-
-    //reservar memoria para los arreglos auxiliares
-    int* val = calloc(n, sizeof(int));         //valores acumulados minimos a cada vertice
-    int* parent = calloc(n, sizeof(int));      //para reconstruir el camino
-    int* visitado = calloc(n, sizeof(int));    //vertices ya procesados
-    
-    if (val == NULL || parent == NULL || visitado == NULL) {
-        free(val);
-        free(parent);
-        free(visitado);
+    //si las etiquetas de componente dicen que no hay ruta, no se recorre toda la componente del inicio
+    if (mismaComponente(grafo, inicio, fin) == 0) {
         return NULL;
     }
+    //el peso maximo define cuantos buckets necesita la cola de Dial
+    int pesoMaximo = (grafo->pesoMaximo > 0) ? grafo->pesoMaximo : 1;
+    enum TipoCola tipoCola = (opciones != NULL) ? opciones->tipoCola : COLA_HEAP_BINARIO;
+    struct ObservadorDijkstra observador = {NULL, NULL};
+    if (opciones != NULL) {
+        observador = opciones->observador;
+    }
 
-    //inicializar todos los valores a infinito (excepto el inicio)
-    for (int i = 0; i < n; ++i) {
-        val[i] = INT_MAX / 4; //valor muy grande (infinito)
-        parent[i] = -1; //sin padre todavia
-        visitado[i] = 0; //no visitado
+    //con todos los pesos en 1, BFS encuentra el mismo valor minimo sin cola de prioridad
+    //(solo si nadie pidio seguir los pasos o grabar la cola)
+    if (grafoPesosUnitarios(grafo) && observador.expandido == NULL && (opciones == NULL || opciones->traza == NULL)) {
+        return caminoPesosUnitarios(grafo, inicio, fin, espacio);
     }
-    val[inicio] = 0; //el valor para llegar al inicio es 0
 
-    //crear la cola de prioridad
-    struct ColaPrioridad* cola = crearColaPrioridad(n);
+    //reutilizar la cola del espacio; los valores pendientes nunca superan minimo + pesoMaximo
+    struct ColaPrioridad* cola = colaDeEspacio(espacio, tipoCola, pesoMaximo);
     if (cola == NULL) {
-        free(val);
-        free(parent);
-        free(visitado);
         return NULL;
     }
+    cola->traza = (opciones != NULL) ? opciones->traza : NULL;
+    if (cola->traza != NULL) {
+        cola->traza->vertices = n;
+        cola->traza->rango = pesoMaximo;
+    }
+
+    //empezar una consulta nueva: todos los valores pasan a infinito y nadie esta visitado en O(1)
+    nuevaConsulta(espacio);
+    espacioAsignarValor(espacio, inicio, 0); //el valor para llegar al inicio es 0
+    espacio->parent[inicio] = -1; //sin padre
     
     //insertar el vertice de inicio en la cola
     insertarCola(cola, inicio, 0);
 
     int paso = 1; //contador de pasos para imprimir estados
+    int expandidos = 0; //vertices extraidos y procesados
 
     //mientras haya vertices en la cola
     while (cola->tamano > 0) {
@@ -363,16 +179,19 @@ struct Camino* dijkstra(struct Grafo* grafo, int inicio, int fin) {
         int v = actual.vertice;
         
         //si ya visitamos este vertice, ignorarlo
-        if (visitado[v]) {
+        if (espacioVisitado(espacio, v)) {
             continue;
         }
         
         //marcar como visitado
-        visitado[v] = 1;
+        espacioMarcarVisitado(espacio, v);
+        expandidos++;
+        int valV = espacio->val[v];
 
         //explorar todos los vecinos del vertice actual
-        for (int u = 0; u < n; ++u) {
-            int peso = grafo->peso[v][u];
+        for (int e = grafo->offsets[v]; e < grafo->offsets[v + 1]; ++e) {
+            int u = grafo->vecinos[e];
+            int peso = grafo->pesos[e];
             
             //si no hay arista, continuar
             if (peso <= 0) {
@@ -380,17 +199,17 @@ struct Camino* dijkstra(struct Grafo* grafo, int inicio, int fin) {
             }
             
             //si ya visitamos este vecino, ignorarlo
-            if (visitado[u]) {
+            if (espacioVisitado(espacio, u)) {
                 continue;
             }
             
             //calcular el nuevo valor acumulado pasando por v
-            int nuevoVal = val[v] + peso;
+            int nuevoVal = valV + peso;
             
-            //si encontramos un camino mejor al vecino u
-            if (nuevoVal < val[u]) {
-                val[u] = nuevoVal;  //actualizar el valor minimo
-                parent[u] = v;      //registrar que llegamos a u desde v
+            //si encontramos un camino mejor al vecino u (sin valor en esta consulta = infinito)
+            if (!espacioTieneValor(espacio, u) || nuevoVal < espacio->val[u]) {
+                espacioAsignarValor(espacio, u, nuevoVal); //actualizar el valor minimo
+                espacio->parent[u] = v; //registrar que llegamos a u desde v
                 
                 //insertar o actualizar el vertice en la cola
                 //si ya estaba, la funcion insertarCola reduce su valor si mejora
@@ -398,29 +217,96 @@ struct Camino* dijkstra(struct Grafo* grafo, int inicio, int fin) {
             }
         }
 
-        //imprimir estado intermedio despues de relajar vecinos
-        print_estado_dijkstra(paso++, v, val, visitado, n);
+        //avisar al observador (si hay) del estado despues de relajar vecinos
+        if (observador.expandido != NULL) {
+            observador.expandido(observador.contexto, paso++, v, espacio, n);
+        }
         
         //si llegamos al destino, podemos terminar
         if (v == fin) {
             break;
         }
     }
+    cola->traza = NULL;
 
     //reconstruir el camino si se encontro una ruta valida
     struct Camino* camino = NULL;
-    if (val[fin] < INT_MAX / 8) {
-        camino = reconstruirCamino(parent, inicio, fin, val[fin], n);
+    if (espacioVisitado(espacio, fin)) {
+        camino = reconstruirCamino(espacio->parent, inicio, fin, espacio->val[fin], n);
+        if (camino != NULL) {
+            camino->expandidos = expandidos;
+        }
     }
-
-    //liberar memoria
-    liberarColaPrioridad(cola);
-    free(val);
-    free(parent);
-    free(visitado);
     return camino;
 }
 
+/*
+Calcula la distancia minima desde un vertice hacia todos los demas (sin meta, sin caminos).
+E: grafo con pesos no negativos, vertice origen, arreglo dist de tamano vertices, espacio de busqueda.
+S: llena dist (-1 = inalcanzable) y retorna cuantos vertices se alcanzaron, o -1 en error.
+R: espacio con capacidad >= vertices; invariantes del grafo al dia.
+*/
+int dijkstraDistancias(const struct Grafo* grafo, int origen, int* dist, struct EspacioBusqueda* espacio) {
+    if (grafo == NULL || dist == NULL || espacio == NULL || grafo->vertices <= 0 || espacio->capacidad < grafo->vertices) {
+        return -1;
+    }
+    int n = grafo->vertices;
+    if (origen < 0 || origen >= n || !grafo->pesosNoNegativos) {
+        return -1;
+    }
+    for (int i = 0; i < n; ++i) {
+        dist[i] = -1;
+    }
+
+    //pesos unitarios: BFS completo; cada vertice esta a un paso mas que su padre,
+    //que siempre aparece antes en el orden de visita
+    if (grafoPesosUnitarios(grafo)) {
+        bfs_espacio(grafo, origen, -1, espacio);
+        dist[origen] = 0;
+        for (int i = 1; i < espacio->cantidadOrden; ++i) {
+            int v = espacio->orden[i];
+            dist[v] = dist[espacio->parent[v]] + 1;
+        }
+        return espacio->cantidadOrden;
+    }
+
+    int pesoMaximo = (grafo->pesoMaximo > 0) ? grafo->pesoMaximo : 1;
+    struct ColaPrioridad* cola = colaDeEspacio(espacio, COLA_BUCKETS, pesoMaximo);
+    if (cola == NULL) {
+        return -1;
+    }
+    cola->traza = NULL;
+    nuevaConsulta(espacio);
+    espacioAsignarValor(espacio, origen, 0);
+    insertarCola(cola, origen, 0);
+
+    int alcanzados = 0;
+    while (cola->tamano > 0) {
+        struct NodoPrioridad actual = extraerMinimo(cola);
+        int v = actual.vertice;
+        if (v == -1) {
+            break;
+        }
+        espacioMarcarVisitado(espacio, v);
+        dist[v] = espacio->val[v];
+        alcanzados++;
+
+        for (int e = grafo->offsets[v]; e < grafo->offsets[v + 1]; ++e) {
+            int u = grafo->vecinos[e];
+            int peso = grafo->pesos[e];
+            if (peso <= 0 || espacioVisitado(espacio, u)) {
+                continue;
+            }
+            int nuevoVal = dist[v] + peso;
+            if (!espacioTieneValor(espacio, u) || nuevoVal < espacio->val[u]) {
+                espacioAsignarValor(espacio, u, nuevoVal);
+                insertarCola(cola, u, nuevoVal);
+            }
+        }
+    }
+    return alcanzados;
+}
+
 /*
 E: puntero a Camino previamente creado por dijkstra.
 S: libera arreglo de nodos y la estructura.
@@ -2,38 +2,37 @@
 #define DIJKSTRA_H
 
 #include "grafo.h"
+#include "cola_prioridad.h"
+#include "espacio_busqueda.h"
 
 //estructura para el resultado del camino
 struct Camino {
     int* nodos; //lista de nodos/vertices en el camino creado
     int longitud; //numero de nodos en el camino
     int valorTotal; //valor total del camino
+    int expandidos; //vertices extraidos de la cola durante la busqueda
 };
 
-//nodo actual al que se esta comparando el valor
-//estructura para la cola de prioridad (min-heap)
-struct NodoPrioridad {
-    int vertice;   //nodo/vertice del grafo
-    int valor; //valor acumulado desde el inicio
+//observador opcional de Dijkstra: se llama despues de relajar los vecinos de cada vertice
+//extraido; con expandido en NULL la busqueda no hace ninguna salida
+struct ObservadorDijkstra {
+    void (*expandido)(void* contexto, int paso, int actual, const struct EspacioBusqueda* espacio, int n);
+    void* contexto; //dato libre que se pasa tal cual al observador
 };
 
-//estructura que mantiene los nodos ordenados por valor (el de menor valor esta al frente)
-//se ocupa el menor para saber por cuales aristas son las que menos costo de pasar tienen
-struct ColaPrioridad {
-    struct NodoPrioridad* heap;
-    int* posiciones; //para actualizaciones de prioridades
-    int tamano; //cuantos elementos hay en el heap
-    int capacidad; //tamano maximo del heap (numero de vertices del grafo)
+//opciones de ejecucion para dijkstraConOpciones
+struct OpcionesDijkstra {
+    enum TipoCola tipoCola; //implementacion de la cola de prioridad
+    struct TrazaCola* traza; //si no es NULL, registra las operaciones de la cola
+    struct ObservadorDijkstra observador; //seguimiento paso a paso (desactivado si esta en cero)
 };
 
 // funciones de Dijkstra
 struct Camino* dijkstra(struct Grafo* grafo, int inicio, int fin);
+struct Camino* dijkstraConOpciones(struct Grafo* grafo, int inicio, int fin, const struct OpcionesDijkstra* opciones);
+struct Camino* dijkstraConEspacio(const struct Grafo* grafo, int inicio, int fin, const struct OpcionesDijkstra* opciones, struct EspacioBusqueda* espacio);
+int dijkstraDistancias(const struct Grafo* grafo, int origen, int* dist, struct EspacioBusqueda* espacio);
 void liberarCamino(struct Camino* camino);
+struct Camino* reconstruirCamino(const int* parent, int inicio, int fin, int valorFin, int vertices);
 
-// funciones de cola de prioridad
-struct ColaPrioridad* crearColaPrioridad(int capacidad);
-void insertarCola(struct ColaPrioridad* cola, int vertice, int valor);
-struct NodoPrioridad extraerMinimo(struct ColaPrioridad* cola);
-void liberarColaPrioridad(struct ColaPrioridad* cola);
-
-#endif
\ No newline at end of file
+#endif
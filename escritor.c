@@ -0,0 +1,113 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "escritor.h"
+
+/*
+E: archivo de salida abierto y capacidad del buffer en bytes (0 = 1 MiB).
+S: puntero a escritor listo o NULL en error.
+R: el archivo debe seguir abierto hasta liberar el escritor.
+*/
+struct Escritor* crearEscritor(FILE* destino, size_t capacidad) {
+    if (destino == NULL) {
+        return NULL;
+    }
+    if (capacidad == 0) {
+        capacidad = (size_t)1 << 20;
+    }
+    struct Escritor* escritor = calloc(1, sizeof(struct Escritor));
+    if (escritor == NULL) {
+        return NULL;
+    }
+    escritor->buffer = malloc(capacidad);
+    if (escritor->buffer == NULL) {
+        free(escritor);
+        return NULL;
+    }
+    escritor->destino = destino;
+    escritor->capacidad = capacidad;
+    return escritor;
+}
+
+/*
+E: escritor, bloque de bytes y su tamano.
+S: agrega los bytes; los bloques mas grandes que el buffer van directo al archivo.
+R: escritor valido.
+*/
+void escribirBytes(struct Escritor* escritor, const char* datos, size_t cantidad) {
+    if (cantidad > escritor->capacidad - escritor->usado) {
+        vaciarEscritor(escritor);
+        if (cantidad > escritor->capacidad) {
+            if (fwrite(datos, 1, cantidad, escritor->destino) != cantidad) {
+                escritor->error = 1;
+            }
+            return;
+        }
+    }
+    memcpy(escritor->buffer + escritor->usado, datos, cantidad);
+    escritor->usado += cantidad;
+}
+
+/*
+E: escritor y cadena terminada en '\0'.
+S: agrega la cadena sin el terminador.
+R: escritor valido.
+*/
+void escribirTexto(struct Escritor* escritor, const char* texto) {
+    escribirBytes(escritor, texto, strlen(texto));
+}
+
+/*
+E: escritor y entero.
+S: agrega el entero en decimal (sin pasar por printf).
+R: escritor valido.
+*/
+void escribirEntero(struct Escritor* escritor, long long valor) {
+    char digitos[24];
+    int cantidad = 0;
+
+    //trabajar con el valor sin signo para que LLONG_MIN no desborde
+    unsigned long long resto = (valor < 0) ? 0ULL - (unsigned long long)valor : (unsigned long long)valor;
+    do {
+        digitos[sizeof(digitos) - 1 - cantidad++] = (char)('0' + resto % 10);
+        resto /= 10;
+    } while (resto > 0);
+    if (valor < 0) {
+        digitos[sizeof(digitos) - 1 - cantidad++] = '-';
+    }
+    escribirBytes(escritor, digitos + sizeof(digitos) - cantidad, (size_t)cantidad);
+}
+
+/*
+E: escritor.
+S: pasa los bytes pendientes al archivo y lo vacia (fflush); 0 si OK, -1 si hubo algun error.
+R: escritor valido; llamarlo al terminar cada cuadro de una animacion.
+*/
+int vaciarEscritor(struct Escritor* escritor) {
+    if (escritor->usado > 0) {
+        if (fwrite(escritor->buffer, 1, escritor->usado, escritor->destino) != escritor->usado) {
+            escritor->error = 1;
+        }
+        escritor->usado = 0;
+    }
+    if (fflush(escritor->destino) != 0) {
+        escritor->error = 1;
+    }
+    return escritor->error ? -1 : 0;
+}
+
+/*
+E: escritor previamente creado.
+S: vacia lo pendiente y libera el buffer y la estructura (el archivo no se cierra);
+   0 si todas las escrituras fueron exitosas, -1 si no.
+R: escritor puede ser NULL, no usar despues.
+*/
+int liberarEscritor(struct Escritor* escritor) {
+    if (escritor == NULL) {
+        return 0;
+    }
+    int resultado = vaciarEscritor(escritor);
+    free(escritor->buffer);
+    free(escritor);
+    return resultado;
+}
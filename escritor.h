@@ -0,0 +1,33 @@
+#ifndef ESCRITOR_H
+#define ESCRITOR_H
+
+#include <stddef.h>
+#include <stdio.h>
+
+//escritura con un solo buffer grande: se acumulan los bytes y se pasan al archivo en bloques,
+//en lugar de una llamada a printf por dato
+struct Escritor {
+    FILE* destino; //archivo de salida (no se cierra al liberar)
+    char* buffer; //bytes pendientes
+    size_t capacidad; //tamano del buffer
+    size_t usado; //bytes pendientes en buffer
+    int error; //1 si alguna escritura al destino fallo
+};
+
+// funciones del escritor
+struct Escritor* crearEscritor(FILE* destino, size_t capacidad);
+void escribirBytes(struct Escritor* escritor, const char* datos, size_t cantidad);
+void escribirTexto(struct Escritor* escritor, const char* texto);
+void escribirEntero(struct Escritor* escritor, long long valor);
+int vaciarEscritor(struct Escritor* escritor);
+int liberarEscritor(struct Escritor* escritor);
+
+//un caracter; en el encabezado porque se usa en los ciclos que recorren celdas o aristas
+static inline void escribirCaracter(struct Escritor* escritor, char c) {
+    if (escritor->usado == escritor->capacidad) {
+        vaciarEscritor(escritor);
+    }
+    escritor->buffer[escritor->usado++] = c;
+}
+
+#endif
@@ -0,0 +1,106 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "espacio_busqueda.h"
+
+/*
+E: cantidad de vertices mayor a 0.
+S: puntero a espacio con todas las marcas en 0 (epoca 0 nunca se usa) o NULL en error.
+R: memoria disponible; liberar con liberarEspacioBusqueda.
+*/
+struct EspacioBusqueda* crearEspacioBusqueda(int capacidad) {
+    if (capacidad <= 0) {
+        return NULL;
+    }
+    struct EspacioBusqueda* espacio = calloc(1, sizeof(struct EspacioBusqueda));
+    if (espacio == NULL) {
+        return NULL;
+    }
+
+    espacio->capacidad = capacidad;
+    espacio->marcaVisitado = calloc((size_t)capacidad, sizeof(unsigned int));
+    espacio->marcaValor = calloc((size_t)capacidad, sizeof(unsigned int));
+    espacio->val = malloc((size_t)capacidad * sizeof(int));
+    espacio->parent = malloc((size_t)capacidad * sizeof(int));
+    espacio->orden = malloc((size_t)capacidad * sizeof(int));
+    espacio->camino = malloc((size_t)capacidad * sizeof(int));
+    if (espacio->marcaVisitado == NULL || espacio->marcaValor == NULL || espacio->val == NULL ||
+        espacio->parent == NULL || espacio->orden == NULL || espacio->camino == NULL) {
+        liberarEspacioBusqueda(espacio);
+        return NULL;
+    }
+    return espacio;
+}
+
+/*
+E: direccion del puntero al espacio (puede apuntar a NULL) y vertices del grafo actual.
+S: reutiliza el espacio si alcanza; si no, lo reemplaza por uno nuevo. 0 si OK, -1 en error.
+R: vertices mayor a 0; en error el espacio anterior se conserva.
+*/
+int prepararEspacioBusqueda(struct EspacioBusqueda** espacio, int vertices) {
+    if (espacio == NULL || vertices <= 0) {
+        return -1;
+    }
+    if (*espacio != NULL && (*espacio)->capacidad >= vertices) {
+        return 0;
+    }
+    struct EspacioBusqueda* nuevo = crearEspacioBusqueda(vertices);
+    if (nuevo == NULL) {
+        return -1;
+    }
+    liberarEspacioBusqueda(*espacio);
+    *espacio = nuevo;
+    return 0;
+}
+
+/*
+E: espacio valido.
+S: empieza una consulta nueva: todos los vertices pasan a no visitados y sin valor en O(1).
+R: cada 2^32 consultas la epoca da la vuelta y las marcas se limpian en O(V).
+*/
+void nuevaConsulta(struct EspacioBusqueda* espacio) {
+    espacio->epoca++;
+    if (espacio->epoca == 0) {
+        memset(espacio->marcaVisitado, 0, (size_t)espacio->capacidad * sizeof(unsigned int));
+        memset(espacio->marcaValor, 0, (size_t)espacio->capacidad * sizeof(unsigned int));
+        espacio->epoca = 1;
+    }
+    espacio->cantidadOrden = 0;
+}
+
+/*
+E: espacio valido, tipo de cola y rango de valores.
+S: retorna la cola del espacio vacia y lista para usar; la recrea solo si cambia el tipo o el rango no alcanza.
+R: la cola pertenece al espacio, no liberarla aparte.
+*/
+struct ColaPrioridad* colaDeEspacio(struct EspacioBusqueda* espacio, enum TipoCola tipo, int rango) {
+    struct ColaPrioridad* cola = espacio->cola;
+    if (cola != NULL && cola->tipo == tipo && (tipo != COLA_BUCKETS || espacio->rangoCola >= rango)) {
+        vaciarColaPrioridad(cola);
+        return cola;
+    }
+
+    liberarColaPrioridad(cola);
+    espacio->cola = crearColaPrioridadTipo(espacio->capacidad, tipo, rango);
+    espacio->rangoCola = rango;
+    return espacio->cola;
+}
+
+/*
+E: espacio previamente creado.
+S: libera los arreglos, la cola y la estructura.
+R: espacio puede ser NULL, no usar despues.
+*/
+void liberarEspacioBusqueda(struct EspacioBusqueda* espacio) {
+    if (espacio == NULL) {
+        return;
+    }
+    free(espacio->marcaVisitado);
+    free(espacio->marcaValor);
+    free(espacio->val);
+    free(espacio->parent);
+    free(espacio->orden);
+    free(espacio->camino);
+    liberarColaPrioridad(espacio->cola);
+    free(espacio);
+}
@@ -0,0 +1,48 @@
+#ifndef ESPACIO_BUSQUEDA_H
+#define ESPACIO_BUSQUEDA_H
+
+#include "cola_prioridad.h"
+
+//espacio de trabajo reutilizable entre consultas sobre el mismo grafo
+//en lugar de limpiar visitados y valores en O(V) por consulta, cada consulta tiene
+//una epoca; una marca distinta de la epoca actual significa "no visitado" / "infinito"
+struct EspacioBusqueda {
+    int capacidad; //vertices que soporta
+    unsigned int epoca; //generacion de la consulta actual (nunca 0)
+    unsigned int* marcaVisitado; //marcaVisitado[v] == epoca si v ya fue visitado/expandido
+    unsigned int* marcaValor; //marcaValor[v] == epoca si val[v] es valido en esta consulta
+    int* val; //valor acumulado (solo valido con marcaValor al dia)
+    int* parent; //padre de cada vertice alcanzado en esta consulta
+    int* orden; //orden de visita (tambien sirve de cola FIFO para BFS)
+    int cantidadOrden; //vertices registrados en orden
+    int* camino; //espacio para la secuencia inicio -> meta
+    struct ColaPrioridad* cola; //cola reutilizada por Dijkstra (NULL hasta el primer uso)
+    int rangoCola; //rango con el que se creo la cola (solo buckets)
+};
+
+// funciones del espacio de busqueda
+struct EspacioBusqueda* crearEspacioBusqueda(int capacidad);
+int prepararEspacioBusqueda(struct EspacioBusqueda** espacio, int vertices);
+void nuevaConsulta(struct EspacioBusqueda* espacio);
+struct ColaPrioridad* colaDeEspacio(struct EspacioBusqueda* espacio, enum TipoCola tipo, int rango);
+void liberarEspacioBusqueda(struct EspacioBusqueda* espacio);
+
+//consultas O(1) usadas en los ciclos internos de las busquedas
+static inline int espacioVisitado(const struct EspacioBusqueda* espacio, int v) {
+    return espacio->marcaVisitado[v] == espacio->epoca;
+}
+
+static inline void espacioMarcarVisitado(struct EspacioBusqueda* espacio, int v) {
+    espacio->marcaVisitado[v] = espacio->epoca;
+}
+
+static inline int espacioTieneValor(const struct EspacioBusqueda* espacio, int v) {
+    return espacio->marcaValor[v] == espacio->epoca;
+}
+
+static inline void espacioAsignarValor(struct EspacioBusqueda* espacio, int v, int valor) {
+    espacio->marcaValor[v] = espacio->epoca;
+    espacio->val[v] = valor;
+}
+
+#endif
@@ -0,0 +1,146 @@
+#include <string.h>
+
+#include "exportacion.h"
+#include "escritor.h"
+
+//en todos los formatos se omiten las entradas con peso 0 (aristas eliminadas); con pesos
+//simetricos cada arista sale una vez y sin simetria se escribe cada direccion por separado
+
+/*
+E: grafo, entrada e del vertice v.
+S: retorna 1 si la entrada debe escribirse como arista (una sola vez por arista si hay simetria).
+R: entrada dentro de la lista de v.
+*/
+static int entradaExportable(const struct Grafo* grafo, int v, int e) {
+    if (grafo->pesos[e] <= 0) {
+        return 0;
+    }
+    return !grafo->pesosSimetricos || grafo->vecinos[e] > v;
+}
+
+/*
+E: escritor, tres enteros y la base de los indices (0 o 1).
+S: escribe "u v peso\n" sumando la base a los indices.
+R: escritor valido.
+*/
+static void escribirTerna(struct Escritor* escritor, int u, int v, int peso, int base) {
+    escribirEntero(escritor, (long long)u + base);
+    escribirCaracter(escritor, ' ');
+    escribirEntero(escritor, (long long)v + base);
+    escribirCaracter(escritor, ' ');
+    escribirEntero(escritor, peso);
+    escribirCaracter(escritor, '\n');
+}
+
+/*
+Escribe el grafo completo en un formato disperso en una sola pasada sobre la adyacencia.
+E: grafo, ruta de salida ("-" = salida estandar) y formato.
+S: 0 si OK, -1 si no se pudo crear o escribir el archivo.
+R: grafo valido; costo O(vertices + entradas) en tiempo y O(1) de memoria extra aparte del buffer.
+*/
+int exportarGrafo(const struct Grafo* grafo, const char* ruta, enum FormatoExportacion formato) {
+    if (grafo == NULL || grafo->vertices <= 0 || grafo->offsets == NULL || ruta == NULL ||
+        formato < 0 || formato >= NUM_FORMATOS_EXPORTACION) {
+        return -1;
+    }
+
+    //los encabezados de Matrix Market y DIMACS llevan la cantidad de aristas antes de listarlas
+    long long aristas = 0;
+    for (int v = 0; v < grafo->vertices; ++v) {
+        for (int e = grafo->offsets[v]; e < grafo->offsets[v + 1]; ++e) {
+            aristas += entradaExportable(grafo, v, e);
+        }
+    }
+
+    int salidaEstandar = strcmp(ruta, "-") == 0;
+    FILE* f = salidaEstandar ? stdout : fopen(ruta, "wb");
+    if (f == NULL) {
+        perror("No se pudo crear el archivo");
+        return -1;
+    }
+    struct Escritor* escritor = crearEscritor(f, 0);
+    if (escritor == NULL) {
+        printf("No se pudo reservar memoria para exportar el grafo.\n");
+        if (!salidaEstandar) {
+            fclose(f);
+        }
+        return -1;
+    }
+
+    int base = 1;
+    if (formato == EXPORTAR_LISTA_ARISTAS) {
+        base = 0;
+        escribirTexto(escritor, "# vertices ");
+        escribirEntero(escritor, grafo->vertices);
+        escribirTexto(escritor, grafo->pesosSimetricos ? " aristas " : " arcos ");
+        escribirEntero(escritor, aristas);
+        escribirCaracter(escritor, '\n');
+    } else if (formato == EXPORTAR_MATRIX_MARKET) {
+        //"symmetric" guarda solo el triangulo inferior: se escribe (mayor, menor)
+        escribirTexto(escritor, grafo->pesosSimetricos ? "%%MatrixMarket matrix coordinate integer symmetric\n"
+                                                       : "%%MatrixMarket matrix coordinate integer general\n");
+        escribirEntero(escritor, grafo->vertices);
+        escribirCaracter(escritor, ' ');
+        escribirEntero(escritor, grafo->vertices);
+        escribirCaracter(escritor, ' ');
+        escribirEntero(escritor, aristas);
+        escribirCaracter(escritor, '\n');
+    } else {
+        //DIMACS solo tiene arcos dirigidos: cada arista no dirigida aporta sus dos direcciones
+        escribirTexto(escritor, "c grafo exportado desde Laberintos_Grafos\np sp ");
+        escribirEntero(escritor, grafo->vertices);
+        escribirCaracter(escritor, ' ');
+        escribirEntero(escritor, grafo->pesosSimetricos ? aristas * 2 : aristas);
+        escribirCaracter(escritor, '\n');
+    }
+
+    for (int v = 0; v < grafo->vertices; ++v) {
+        for (int e = grafo->offsets[v]; e < grafo->offsets[v + 1]; ++e) {
+            if (!entradaExportable(grafo, v, e)) {
+                continue;
+            }
+            int u = grafo->vecinos[e];
+            int peso = grafo->pesos[e];
+            if (formato == EXPORTAR_DIMACS) {
+                escribirTexto(escritor, "a ");
+                escribirTerna(escritor, v, u, peso, base);
+                if (grafo->pesosSimetricos) {
+                    escribirTexto(escritor, "a ");
+                    escribirTerna(escritor, u, v, peso, base);
+                }
+            } else if (formato == EXPORTAR_MATRIX_MARKET && grafo->pesosSimetricos) {
+                escribirTerna(escritor, u, v, peso, base); //u > v: triangulo inferior
+            } else {
+                escribirTerna(escritor, v, u, peso, base);
+            }
+        }
+    }
+
+    int resultado = liberarEscritor(escritor);
+    if (!salidaEstandar && fclose(f) != 0) {
+        resultado = -1;
+    }
+    if (resultado != 0) {
+        printf("No se pudo escribir el archivo.\n");
+    }
+    return resultado;
+}
+
+/*
+E: formato de exportacion.
+S: nombre legible del formato.
+R: ninguna.
+*/
+const char* nombreFormatoExportacion(enum FormatoExportacion formato) {
+    switch (formato) {
+        case EXPORTAR_LISTA_ARISTAS:
+            return "lista de aristas";
+        case EXPORTAR_MATRIX_MARKET:
+            return "Matrix Market (.mtx)";
+        case EXPORTAR_DIMACS:
+            return "DIMACS (.gr)";
+        case NUM_FORMATOS_EXPORTACION:
+            break;
+    }
+    return "desconocido";
+}
@@ -0,0 +1,18 @@
+#ifndef EXPORTACION_H
+#define EXPORTACION_H
+
+#include "grafo.h"
+
+//formatos de exportacion dispersos: el tamano del archivo crece con vertices + aristas
+enum FormatoExportacion {
+    EXPORTAR_LISTA_ARISTAS = 0, //"u v peso" por linea, indices desde 0
+    EXPORTAR_MATRIX_MARKET, //coordinate integer, indices desde 1 (SciPy, MATLAB, SuiteSparse)
+    EXPORTAR_DIMACS, //.gr del 9no reto DIMACS de caminos minimos, arcos dirigidos desde 1
+    NUM_FORMATOS_EXPORTACION
+};
+
+// funciones de exportacion
+int exportarGrafo(const struct Grafo* grafo, const char* ruta, enum FormatoExportacion formato);
+const char* nombreFormatoExportacion(enum FormatoExportacion formato);
+
+#endif
@@ -0,0 +1,321 @@
+#include <stdlib.h>
+
+#include "generador.h"
+#include "aleatorio.h"
+#include "conjuntos.h"
+
+//las salas ocupan las celdas de fila y columna impares; entre dos salas vecinas hay
+//una celda de pared que se abre al unirlas. La sala s esta en la fila 2 * (s / salasC) + 1
+//y la columna 2 * (s % salasC) + 1
+
+//datos compartidos por los generadores
+struct Salas {
+    struct Maze* maze;
+    int filas; //salas por columna
+    int columnas; //salas por fila
+    int cantidad; //filas * columnas
+};
+
+/*
+E: salas y sala s.
+S: abre la celda de la sala.
+R: s dentro de [0, cantidad-1].
+*/
+static void abrirSala(const struct Salas* salas, int s) {
+    salas->maze->cells[2 * (s / salas->columnas) + 1][2 * (s % salas->columnas) + 1] = '.';
+}
+
+/*
+E: salas y dos salas vecinas.
+S: abre ambas salas y la pared que las separa.
+R: a y b vecinas en la cuadricula de salas.
+*/
+static void abrirPared(const struct Salas* salas, int a, int b) {
+    int fila = (a / salas->columnas) + (b / salas->columnas) + 1;
+    int col = (a % salas->columnas) + (b % salas->columnas) + 1;
+    salas->maze->cells[fila][col] = '.';
+    abrirSala(salas, a);
+    abrirSala(salas, b);
+}
+
+/*
+E: salas, sala s y arreglo de salida con espacio para 4.
+S: llena out con las salas vecinas (arriba, izquierda, derecha, abajo) y retorna cuantas son.
+R: s dentro de [0, cantidad-1].
+*/
+static int salasVecinas(const struct Salas* salas, int s, int* out) {
+    int fila = s / salas->columnas;
+    int col = s % salas->columnas;
+    int count = 0;
+    if (fila > 0) {
+        out[count++] = s - salas->columnas;
+    }
+    if (col > 0) {
+        out[count++] = s - 1;
+    }
+    if (col + 1 < salas->columnas) {
+        out[count++] = s + 1;
+    }
+    if (fila + 1 < salas->filas) {
+        out[count++] = s + salas->columnas;
+    }
+    return count;
+}
+
+/*
+E: salas y dos salas vecinas.
+S: retorna 1 si la pared entre ellas ya esta abierta.
+R: a y b vecinas.
+*/
+static int paredAbierta(const struct Salas* salas, int a, int b) {
+    int fila = (a / salas->columnas) + (b / salas->columnas) + 1;
+    int col = (a % salas->columnas) + (b % salas->columnas) + 1;
+    return salas->maze->cells[fila][col] != WALL;
+}
+
+/*
+E: salas y generador sembrado.
+S: talla el laberinto con DFS iterativo (backtracker); 0 si OK, -1 sin memoria.
+R: pila explicita de a lo sumo cantidad salas, sin recursion.
+*/
+static int generarBacktracker(const struct Salas* salas, struct Aleatorio* gen) {
+    char* visitado = calloc(salas->cantidad, sizeof(char));
+    int* pila = malloc((size_t)salas->cantidad * sizeof(int));
+    if (visitado == NULL || pila == NULL) {
+        free(visitado);
+        free(pila);
+        return -1;
+    }
+
+    int inicio = (int)aleatorioRango(gen, (uint32_t)salas->cantidad);
+    int tope = 0;
+    pila[tope++] = inicio;
+    visitado[inicio] = 1;
+    abrirSala(salas, inicio);
+
+    while (tope > 0) {
+        int actual = pila[tope - 1];
+
+        //elegir al azar entre las vecinas que faltan por visitar
+        int vecinas[4];
+        int libres[4];
+        int count = salasVecinas(salas, actual, vecinas);
+        int cantidadLibres = 0;
+        for (int k = 0; k < count; ++k) {
+            if (!visitado[vecinas[k]]) {
+                libres[cantidadLibres++] = vecinas[k];
+            }
+        }
+        if (cantidadLibres == 0) {
+            tope--; //sin salida: retroceder
+            continue;
+        }
+
+        int siguiente = libres[aleatorioRango(gen, (uint32_t)cantidadLibres)];
+        abrirPared(salas, actual, siguiente);
+        visitado[siguiente] = 1;
+        pila[tope++] = siguiente;
+    }
+
+    free(visitado);
+    free(pila);
+    return 0;
+}
+
+/*
+E: salas y generador sembrado.
+S: talla el laberinto con Kruskal aleatorio; 0 si OK, -1 sin memoria.
+R: memoria para 2 paredes por sala y los conjuntos disjuntos.
+*/
+static int generarKruskal(const struct Salas* salas, struct Aleatorio* gen) {
+    //pared = sala * 2 + direccion (0 = derecha, 1 = abajo)
+    int* paredes = malloc((size_t)salas->cantidad * 2 * sizeof(int));
+    struct ConjuntosDisjuntos* conjuntos = crearConjuntos(salas->cantidad);
+    if (paredes == NULL || conjuntos == NULL) {
+        free(paredes);
+        liberarConjuntos(conjuntos);
+        return -1;
+    }
+
+    int cantidad = 0;
+    for (int s = 0; s < salas->cantidad; ++s) {
+        abrirSala(salas, s);
+        if (s % salas->columnas + 1 < salas->columnas) {
+            paredes[cantidad++] = s * 2;
+        }
+        if (s / salas->columnas + 1 < salas->filas) {
+            paredes[cantidad++] = s * 2 + 1;
+        }
+    }
+
+    //barajar con Fisher-Yates y abrir las paredes que unen conjuntos distintos
+    for (int i = cantidad - 1; i > 0; --i) {
+        int j = (int)aleatorioRango(gen, (uint32_t)i + 1);
+        int tmp = paredes[i];
+        paredes[i] = paredes[j];
+        paredes[j] = tmp;
+    }
+    int uniones = 0;
+    for (int i = 0; i < cantidad && uniones < salas->cantidad - 1; ++i) {
+        int a = paredes[i] / 2;
+        int b = (paredes[i] % 2 == 0) ? a + 1 : a + salas->columnas;
+        if (unirConjuntos(conjuntos, a, b)) {
+            abrirPared(salas, a, b);
+            uniones++;
+        }
+    }
+
+    free(paredes);
+    liberarConjuntos(conjuntos);
+    return 0;
+}
+
+/*
+E: salas y generador sembrado.
+S: talla el laberinto con el algoritmo de Wilson (arbol generador uniforme); 0 si OK, -1 sin memoria.
+R: cada caminata guarda solo la ultima salida de cada sala, asi los ciclos se borran solos.
+*/
+static int generarWilson(const struct Salas* salas, struct Aleatorio* gen) {
+    char* enArbol = calloc(salas->cantidad, sizeof(char));
+    int* salida = malloc((size_t)salas->cantidad * sizeof(int));
+    if (enArbol == NULL || salida == NULL) {
+        free(enArbol);
+        free(salida);
+        return -1;
+    }
+
+    int raiz = (int)aleatorioRango(gen, (uint32_t)salas->cantidad);
+    enArbol[raiz] = 1;
+    abrirSala(salas, raiz);
+
+    for (int s = 0; s < salas->cantidad; ++s) {
+        //caminata aleatoria desde s hasta tocar el arbol
+        int actual = s;
+        while (!enArbol[actual]) {
+            int vecinas[4];
+            int count = salasVecinas(salas, actual, vecinas);
+            salida[actual] = vecinas[aleatorioRango(gen, (uint32_t)count)];
+            actual = salida[actual];
+        }
+
+        //repetir la caminata siguiendo la ultima salida de cada sala: es el camino sin ciclos
+        actual = s;
+        while (!enArbol[actual]) {
+            enArbol[actual] = 1;
+            abrirPared(salas, actual, salida[actual]);
+            actual = salida[actual];
+        }
+    }
+
+    free(enArbol);
+    free(salida);
+    return 0;
+}
+
+/*
+E: salas, generador sembrado y probabilidad de trenzado [0, 1].
+S: abre una pared extra en cada callejon sin salida con esa probabilidad (prefiere unirlo con otro
+   callejon); el laberinto deja de ser perfecto y aparecen ciclos.
+R: laberinto perfecto ya tallado.
+*/
+static void trenzar(const struct Salas* salas, struct Aleatorio* gen, double trenzado) {
+    uint64_t umbral = umbralProbabilidad(trenzado);
+    for (int s = 0; s < salas->cantidad; ++s) {
+        int vecinas[4];
+        int count = salasVecinas(salas, s, vecinas);
+        int cerradas[4];
+        int cantidadCerradas = 0;
+        for (int k = 0; k < count; ++k) {
+            if (!paredAbierta(salas, s, vecinas[k])) {
+                cerradas[cantidadCerradas++] = vecinas[k];
+            }
+        }
+
+        //un callejon tiene una sola pared abierta
+        if (count - cantidadCerradas != 1 || cantidadCerradas == 0 || !aleatorioBernoulli(gen, umbral)) {
+            continue;
+        }
+
+        //preferir una vecina que tambien sea callejon: se eliminan dos de una vez
+        int elegida = cerradas[aleatorioRango(gen, (uint32_t)cantidadCerradas)];
+        for (int k = 0; k < cantidadCerradas; ++k) {
+            int suyas[4];
+            int suCount = salasVecinas(salas, cerradas[k], suyas);
+            int abiertas = 0;
+            for (int j = 0; j < suCount; ++j) {
+                abiertas += paredAbierta(salas, cerradas[k], suyas[j]);
+            }
+            if (abiertas == 1) {
+                elegida = cerradas[k];
+                break;
+            }
+        }
+        abrirPared(salas, s, elegida);
+    }
+}
+
+/*
+Genera un laberinto con el algoritmo indicado y lo deja listo como si se hubiera cargado.
+E: laberinto destino, filas y columnas de celdas (incluye muros), algoritmo, trenzado [0, 1]
+   (0 = laberinto perfecto) y semilla.
+S: reemplaza el laberinto; I queda en la sala de arriba a la izquierda y F en la de abajo a la
+   derecha; 0 si OK, -1 si las dimensiones no son validas o falta memoria.
+R: filas y columnas >= 3 con al menos 2 salas (3 x 5 o 5 x 3); con dimensiones pares la ultima
+   fila/columna queda de muro;
+   la misma semilla con los mismos parametros repite el mismo laberinto.
+*/
+int generarLaberinto(struct Maze* maze, int rows, int cols, enum AlgoritmoLaberinto algoritmo, double trenzado, uint64_t semilla) {
+    if (maze == NULL || rows < 3 || cols < 3 || algoritmo < 0 || algoritmo >= NUM_ALGORITMOS_LABERINTO) {
+        return -1;
+    }
+    if ((rows - 1) / 2 * ((cols - 1) / 2) < 2) {
+        return -1; //I y F necesitan salas distintas
+    }
+    if (create_maze(maze, rows, cols) != 0) {
+        return -1;
+    }
+
+    struct Salas salas = {maze, (rows - 1) / 2, (cols - 1) / 2, ((rows - 1) / 2) * ((cols - 1) / 2)};
+    struct Aleatorio gen;
+    sembrarAleatorio(&gen, semilla);
+
+    int resultado = -1;
+    if (algoritmo == LABERINTO_BACKTRACKER) {
+        resultado = generarBacktracker(&salas, &gen);
+    } else if (algoritmo == LABERINTO_KRUSKAL) {
+        resultado = generarKruskal(&salas, &gen);
+    } else {
+        resultado = generarWilson(&salas, &gen);
+    }
+    if (resultado != 0) {
+        free_maze(maze);
+        return -1;
+    }
+
+    if (trenzado > 0.0) {
+        trenzar(&salas, &gen, trenzado);
+    }
+
+    maze->cells[1][1] = START;
+    maze->cells[2 * salas.filas - 1][2 * salas.columnas - 1] = END;
+    return 0;
+}
+
+/*
+E: algoritmo de generacion.
+S: nombre legible del algoritmo.
+R: ninguna.
+*/
+const char* nombreAlgoritmoLaberinto(enum AlgoritmoLaberinto algoritmo) {
+    switch (algoritmo) {
+        case LABERINTO_BACKTRACKER:
+            return "Backtracker (DFS iterativo)";
+        case LABERINTO_KRUSKAL:
+            return "Kruskal (union-find)";
+        case LABERINTO_WILSON:
+            return "Wilson (arbol generador uniforme)";
+        case NUM_ALGORITMOS_LABERINTO:
+            break;
+    }
+    return "desconocido";
+}
@@ -0,0 +1,20 @@
+#ifndef GENERADOR_H
+#define GENERADOR_H
+
+#include <stdint.h>
+
+#include "laberinto.h"
+
+//algoritmos para generar laberintos perfectos (un unico camino entre cada par de salas)
+enum AlgoritmoLaberinto {
+    LABERINTO_BACKTRACKER = 0, //DFS iterativo: pasillos largos y pocas bifurcaciones
+    LABERINTO_KRUSKAL, //paredes en orden aleatorio unidas con union-find: muchas ramas cortas
+    LABERINTO_WILSON, //caminatas aleatorias sin ciclos: arbol generador uniforme
+    NUM_ALGORITMOS_LABERINTO
+};
+
+// funciones de generacion de laberintos
+int generarLaberinto(struct Maze* maze, int rows, int cols, enum AlgoritmoLaberinto algoritmo, double trenzado, uint64_t semilla);
+const char* nombreAlgoritmoLaberinto(enum AlgoritmoLaberinto algoritmo);
+
+#endif
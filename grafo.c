@@ -4,15 +4,17 @@
 #include <math.h>
 
 #include "grafo.h"
+#include "aleatorio.h"
+#include "conjuntos.h"
 
 /*
-E: cantidad de vertices mayor a 0.
-S: puntero a Grafo con matriz de pesos inicializada en 0 o NULL en error.
-R: memoria disponible; vertices positivo.
+E: cantidad de vertices mayor a 0 y cantidad de entradas de adyacencia no negativa.
+S: puntero a Grafo con offsets en 0 y arreglos de vecinos/pesos reservados o NULL en error.
+R: memoria disponible; vertices positivo; el llamador llena offsets, vecinos y pesos.
 .*/
-struct Grafo* crearGrafo(int vertices) {
+struct Grafo* crearGrafo(int vertices, int entradas) {
     //validar que la cantidad de vertices sea positiva
-    if (vertices <= 0) {
+    if (vertices <= 0 || entradas < 0) {
         return NULL;
     }
 
@@ -22,52 +24,135 @@ struct Grafo* crearGrafo(int vertices) {
         return NULL;
     }
 
-    //establecer el numero de vertices
+    //establecer el numero de vertices y de entradas
     grafo->vertices = vertices;
+    grafo->entradas = entradas;
+    grafo->pesosNoNegativos = 1; //todos los pesos empiezan en 0
+    grafo->pesosSimetricos = 1;
+    grafo->pasoCoordenadas = 1; //vecinos en celdas contiguas de la cuadricula
     
-    //reservar memoria para la matriz de pesos (arreglo de punteros a filas)
-    grafo->peso = calloc(vertices, sizeof(int*));
+    //reservar memoria para los offsets (uno extra para marcar el final del ultimo vertice)
+    grafo->offsets = calloc((size_t)vertices + 1, sizeof(int));
+
+    //reservar memoria para los vecinos y pesos (al menos 1 para no depender de calloc(0))
+    size_t capacidad = entradas > 0 ? (size_t)entradas : 1;
+    grafo->vecinos = calloc(capacidad, sizeof(int));
+    grafo->pesos = calloc(capacidad, sizeof(int));
     
     //reservar memoria para el mapeo de indice a coordenadas (para laberintos)
     grafo->indexToCoord = calloc(vertices, sizeof(struct Point));
+
+    //etiquetas de componente; se llenan con etiquetarComponentes cuando la adyacencia esta completa
+    grafo->componente = calloc(vertices, sizeof(int));
     
-    //verificar que ambas asignaciones fueron exitosas
-    if (grafo->peso == NULL || grafo->indexToCoord == NULL) {
-        free(grafo->peso);
+    //verificar que todas las asignaciones fueron exitosas
+    if (grafo->offsets == NULL || grafo->vecinos == NULL || grafo->pesos == NULL || grafo->indexToCoord == NULL || grafo->componente == NULL) {
+        free(grafo->offsets);
+        free(grafo->vecinos);
+        free(grafo->pesos);
         free(grafo->indexToCoord);
+        free(grafo->componente);
         free(grafo);
         return NULL;
     }
 
-    //reservar memoria para cada fila de la matriz de pesos
-    for (int i = 0; i < vertices; ++i) {
-        grafo->peso[i] = calloc(vertices, sizeof(int));
-        
-        //si falla la asignacion, liberar toda la memoria previamente reservada
-        if (grafo->peso[i] == NULL) {
-            //liberar las filas ya asignadas
-            for (int j = 0; j < i; ++j) {
-                free(grafo->peso[j]);
+    //la memoria usada crece con vertices + entradas, no con vertices^2
+    return grafo;
+}
+
+/*
+E: grafo destino, cantidad de vertices, lista de aristas no dirigidas y su cantidad.
+S: reemplaza el contenido del grafo por la adyacencia comprimida de las aristas; 0 si OK, -1 si error.
+R: indices dentro de [0, vertices-1], pesos no negativos, sin aristas repetidas; se ignoran lazos.
+.*/
+int construirAdyacencia(struct Grafo* grafo, int vertices, const struct Arista* aristas, int cantidad) {
+    if (grafo == NULL || vertices <= 0 || cantidad < 0 || (cantidad > 0 && aristas == NULL)) {
+        return -1;
+    }
+
+    //validar las aristas y contar el grado de cada vertice
+    int* grado = calloc(vertices, sizeof(int));
+    if (grado == NULL) {
+        return -1;
+    }
+    int entradas = 0;
+    for (int i = 0; i < cantidad; ++i) {
+        int a = aristas[i].origen;
+        int b = aristas[i].destino;
+        if (a < 0 || b < 0 || a >= vertices || b >= vertices || aristas[i].peso < 0) {
+            free(grado);
+            return -1;
+        }
+        if (a == b) {
+            continue; //un lazo no aporta nada a un recorrido
+        }
+        grado[a]++;
+        grado[b]++;
+        entradas += 2;
+    }
+
+    struct Grafo* nuevo = crearGrafo(vertices, entradas);
+    if (nuevo == NULL) {
+        free(grado);
+        return -1;
+    }
+
+    //suma prefija de grados para obtener el inicio de cada lista
+    for (int v = 0; v < vertices; ++v) {
+        nuevo->offsets[v + 1] = nuevo->offsets[v] + grado[v];
+        grado[v] = nuevo->offsets[v]; //se reutiliza como cursor de escritura
+    }
+
+    //colocar cada arista en la lista de ambos extremos
+    for (int i = 0; i < cantidad; ++i) {
+        int a = aristas[i].origen;
+        int b = aristas[i].destino;
+        if (a == b) {
+            continue;
+        }
+        nuevo->vecinos[grado[a]] = b;
+        nuevo->pesos[grado[a]++] = aristas[i].peso;
+        nuevo->vecinos[grado[b]] = a;
+        nuevo->pesos[grado[b]++] = aristas[i].peso;
+    }
+    free(grado);
+
+    //ordenar cada lista por indice de vecino (insercion, los grados son pequenos)
+    //asi el recorrido de vecinos sigue el mismo orden que tenia la matriz
+    for (int v = 0; v < vertices; ++v) {
+        for (int e = nuevo->offsets[v] + 1; e < nuevo->offsets[v + 1]; ++e) {
+            int vecino = nuevo->vecinos[e];
+            int peso = nuevo->pesos[e];
+            int k = e - 1;
+            while (k >= nuevo->offsets[v] && nuevo->vecinos[k] > vecino) {
+                nuevo->vecinos[k + 1] = nuevo->vecinos[k];
+                nuevo->pesos[k + 1] = nuevo->pesos[k];
+                k--;
             }
-            free(grafo->peso);
-            free(grafo->indexToCoord);
-            free(grafo);
-            return NULL;
+            nuevo->vecinos[k + 1] = vecino;
+            nuevo->pesos[k + 1] = peso;
         }
     }
 
-    //la matriz queda inicializada en 0 por calloc (sin aristas)
-    return grafo;
+    //registrar los invariantes de pesos y las componentes una sola vez, al construir
+    recalcularInvariantes(nuevo);
+    etiquetarComponentes(nuevo);
+
+    //liberar el grafo anterior y transferir los arreglos del nuevo
+    liberarGrafo(grafo);
+    *grafo = *nuevo;
+    free(nuevo); //liberar la estructura temporal, los arreglos quedan en grafo
+    return 0;
 }
 
 /*
 E: puntero a grafo, indices origen/destino y peso mayor o igual a 0.
-S: asigna peso simetrico, retorna 0 si esta bien, -1 si indices fuera de rango.
-R: grafo valido, indices dentro de [0, vertices-1].
+S: actualiza el peso de una arista existente en ambas direcciones; 0 si esta bien, -1 si no existe o indices fuera de rango.
+R: grafo valido, indices dentro de [0, vertices-1]; la estructura CSR es fija, no se agregan aristas nuevas.
 .*/
 int asignarArista(struct Grafo* grafo, int origen, int destino, int peso) {
     //validar que el grafo no sea NULL
-    if (grafo == NULL) {
+    if (grafo == NULL || grafo->offsets == NULL) {
         return -1;
     }
     
@@ -81,14 +166,77 @@ int asignarArista(struct Grafo* grafo, int origen, int destino, int peso) {
         return -1;
     }
 
-    //asignar el peso en ambas direcciones (grafo no dirigido)
-    //esto crea una arista bidireccional entre origen y destino
-    grafo->peso[origen][destino] = peso;
-    grafo->peso[destino][origen] = peso;
+    //buscar la entrada en cada direccion (grafo no dirigido)
+    int ida = -1;
+    int vuelta = -1;
+    for (int e = grafo->offsets[origen]; e < grafo->offsets[origen + 1]; ++e) {
+        if (grafo->vecinos[e] == destino) {
+            ida = e;
+            break;
+        }
+    }
+    for (int e = grafo->offsets[destino]; e < grafo->offsets[destino + 1]; ++e) {
+        if (grafo->vecinos[e] == origen) {
+            vuelta = e;
+            break;
+        }
+    }
+    if (ida == -1 || vuelta == -1) {
+        return -1; //la arista no existe en la estructura
+    }
+
+    //mantener los invariantes: el conteo de no unitarias es exacto,
+    //el minimo y el maximo solo se amplian (siguen siendo cotas validas)
+    //y pesosSimetricos no cambia (igualar una arista no revisa las demas)
+    if (grafo->pesos[ida] > 1) {
+        grafo->entradasNoUnitarias--;
+    }
+    if (grafo->pesos[vuelta] > 1) {
+        grafo->entradasNoUnitarias--;
+    }
+    if (peso > 1) {
+        grafo->entradasNoUnitarias += 2;
+    }
+    if (peso > 0) {
+        if (peso > grafo->pesoMaximo) {
+            grafo->pesoMaximo = peso;
+        }
+        if (grafo->pesoMinimo == 0 || peso < grafo->pesoMinimo) {
+            grafo->pesoMinimo = peso;
+        }
+    }
+
+    //quitar una arista puede separar su componente y agregarla entre dos componentes las une;
+    //las etiquetas quedan viejas hasta el proximo etiquetarComponentes
+    int estabaActiva = grafo->pesos[ida] > 0 || grafo->pesos[vuelta] > 0;
+    if (estabaActiva ? peso == 0 : (peso > 0 && grafo->componente[origen] != grafo->componente[destino])) {
+        grafo->componentesVigentes = 0;
+    }
+
+    //asignar el peso en ambas direcciones
+    grafo->pesos[ida] = peso;
+    grafo->pesos[vuelta] = peso;
     
     return 0; //exito
 }
 
+/*
+E: grafo y dos indices de vertices.
+S: retorna el peso de la arista origen->destino o 0 si no existe.
+R: grafo valido; costo proporcional al grado de origen.
+.*/
+int pesoArista(const struct Grafo* grafo, int origen, int destino) {
+    if (grafo == NULL || grafo->offsets == NULL || origen < 0 || origen >= grafo->vertices) {
+        return 0;
+    }
+    for (int e = grafo->offsets[origen]; e < grafo->offsets[origen + 1]; ++e) {
+        if (grafo->vecinos[e] == destino) {
+            return grafo->pesos[e];
+        }
+    }
+    return 0;
+}
+
 /*
 E: puntero a grafo previamente creado.
 S: libera memoria interna y el grafo.
@@ -99,46 +247,208 @@ void liberarGrafo(struct Grafo* grafo) {
         return;
     }
     
-    //liberar cada fila de la matriz de pesos
-    if (grafo->peso != NULL) {
-        for (int i = 0; i < grafo->vertices; ++i) {
-            free(grafo->peso[i]);
-        }
-        //liberar el arreglo de punteros
-        free(grafo->peso);
-        grafo->peso = NULL;
-    }
+    //liberar los arreglos de la adyacencia comprimida
+    free(grafo->offsets);
+    free(grafo->vecinos);
+    free(grafo->pesos);
+    grafo->offsets = NULL;
+    grafo->vecinos = NULL;
+    grafo->pesos = NULL;
     
     //liberar el arreglo de mapeo de indices a coordenadas
     if (grafo->indexToCoord != NULL) {
         free(grafo->indexToCoord);
         grafo->indexToCoord = NULL;
     }
+    free(grafo->componente);
+    grafo->componente = NULL;
     
-    //reiniciar el contador de vertices
+    //reiniciar los contadores
     grafo->vertices = 0;
+    grafo->entradas = 0;
+    grafo->pesosNoNegativos = 0;
+    grafo->pesoMinimo = 0;
+    grafo->pesoMaximo = 0;
+    grafo->entradasNoUnitarias = 0;
+    grafo->pesosSimetricos = 0;
+    grafo->pasoCoordenadas = 0;
+    grafo->componentes = 0;
+    grafo->componentesVigentes = 0;
+}
+
+/*
+E: grafo y una entrada origen->destino.
+S: retorna el indice de la entrada destino->origen o -1 si no existe.
+R: listas de vecinos ordenadas por indice (asi las dejan construirAdyacencia y build_graph).
+.*/
+static int entradaReversa(const struct Grafo* grafo, int origen, int destino) {
+    int bajo = grafo->offsets[destino];
+    int alto = grafo->offsets[destino + 1] - 1;
+    while (bajo <= alto) {
+        int medio = bajo + (alto - bajo) / 2;
+        if (grafo->vecinos[medio] == origen) {
+            return medio;
+        }
+        if (grafo->vecinos[medio] < origen) {
+            bajo = medio + 1;
+        } else {
+            alto = medio - 1;
+        }
+    }
+    return -1;
+}
+
+/*
+E: grafo con adyacencia comprimida.
+S: recalcula pesosNoNegativos, pesoMinimo, pesoMaximo, entradasNoUnitarias y pesosSimetricos.
+R: usar solo si se modifican los pesos sin pasar por asignarArista; costo O(entradas log grado).
+.*/
+void recalcularInvariantes(struct Grafo* grafo) {
+    if (grafo == NULL || grafo->pesos == NULL || grafo->offsets == NULL) {
+        return;
+    }
+    grafo->pesosNoNegativos = 1;
+    grafo->pesoMinimo = 0;
+    grafo->pesoMaximo = 0;
+    grafo->entradasNoUnitarias = 0;
+    grafo->pesosSimetricos = 1;
+    for (int v = 0; v < grafo->vertices; ++v) {
+        for (int e = grafo->offsets[v]; e < grafo->offsets[v + 1]; ++e) {
+            int peso = grafo->pesos[e];
+
+            //cada arista se compara una vez, desde su extremo de menor indice
+            if (grafo->pesosSimetricos && v < grafo->vecinos[e]) {
+                int reversa = entradaReversa(grafo, v, grafo->vecinos[e]);
+                if (reversa == -1 || grafo->pesos[reversa] != peso) {
+                    grafo->pesosSimetricos = 0;
+                }
+            }
+
+            if (peso < 0) {
+                grafo->pesosNoNegativos = 0;
+            }
+            if (peso <= 0) {
+                continue; //arista eliminada (o invalida)
+            }
+            if (peso != 1) {
+                grafo->entradasNoUnitarias++;
+            }
+            if (peso > grafo->pesoMaximo) {
+                grafo->pesoMaximo = peso;
+            }
+            if (grafo->pesoMinimo == 0 || peso < grafo->pesoMinimo) {
+                grafo->pesoMinimo = peso;
+            }
+        }
+    }
+}
+
+/*
+E: grafo valido.
+S: retorna 1 si todas las aristas activas pesan 1 (BFS da el camino minimo), 0 si no.
+R: invariantes al dia; costo O(1).
+.*/
+int grafoPesosUnitarios(const struct Grafo* grafo) {
+    return grafo != NULL && grafo->pesosNoNegativos && grafo->entradasNoUnitarias == 0;
+}
+
+/*
+E: grafo con adyacencia comprimida.
+S: etiqueta las componentes conexas (union-find sobre las aristas activas) y deja
+   componentesVigentes en 1; 0 si OK, -1 sin memoria (las etiquetas quedan no vigentes).
+R: costo casi O(vertices + entradas); usar despues de cambiar aristas con asignarArista.
+.*/
+int etiquetarComponentes(struct Grafo* grafo) {
+    if (grafo == NULL || grafo->offsets == NULL || grafo->componente == NULL) {
+        return -1;
+    }
+    grafo->componentesVigentes = 0;
+    struct ConjuntosDisjuntos* conjuntos = crearConjuntos(grafo->vertices);
+    if (conjuntos == NULL) {
+        return -1;
+    }
+
+    //cada arista se une una vez, desde su extremo de menor indice
+    for (int v = 0; v < grafo->vertices; ++v) {
+        for (int e = grafo->offsets[v]; e < grafo->offsets[v + 1]; ++e) {
+            if (grafo->vecinos[e] > v && grafo->pesos[e] > 0) {
+                unirConjuntos(conjuntos, v, grafo->vecinos[e]);
+            }
+        }
+    }
+
+    //numerar los representantes en orden de indice y copiar la etiqueta a cada miembro
+    grafo->componentes = 0;
+    for (int v = 0; v < grafo->vertices; ++v) {
+        if (conjuntos->padre[v] == v) {
+            grafo->componente[v] = grafo->componentes++;
+        }
+    }
+    for (int v = 0; v < grafo->vertices; ++v) {
+        grafo->componente[v] = grafo->componente[buscarConjunto(conjuntos, v)];
+    }
+
+    liberarConjuntos(conjuntos);
+    grafo->componentesVigentes = 1;
+    return 0;
+}
+
+/*
+E: grafo y dos vertices.
+S: 1 si hay camino entre a y b, 0 si estan en componentes distintas, -1 si no se sabe
+   (etiquetas no vigentes o indices fuera de rango); el llamador debe buscar en ese caso.
+R: costo O(1).
+.*/
+int mismaComponente(const struct Grafo* grafo, int a, int b) {
+    if (grafo == NULL || !grafo->componentesVigentes || a < 0 || b < 0 || a >= grafo->vertices || b >= grafo->vertices) {
+        return -1;
+    }
+    return grafo->componente[a] == grafo->componente[b];
 }
 
 /*
 E: laberinto cargado, punteros a grafo/start/goal.
-S: construye matriz de pesos (1) y mapea indices; 0 si OK.
+S: construye adyacencia comprimida y mapea indices; el peso de cada entrada u->v es el costo
+   de la celda v (1 para '.', 'I', 'F'; el digito para celdas de terreno); 0 si OK.
 R: laberinto valido, memoria disponible, debe existir S y E.
 .*/
 int build_graph(const struct Maze* maze, struct Grafo* grafo, int* startIndex, int* goalIndex) {
-    //matriz temporal para mapear coordenadas (fila,col) a indices de vertices
-    int indexMap[MAX_ROWS][MAX_COLS];
     int openCells = 0;
+    int entradas = 0;
     *startIndex = -1;
     *goalIndex = -1;
 
-    //primer recorrido: contar celdas transitables y marcar muros
+    //mapa temporal (en heap) de coordenadas (fila,col) a indices de vertices
+    //se indexa como indexMap[r * cols + c] y su tamano depende del laberinto
+    int* indexMap = malloc((size_t)maze->rows * maze->cols * sizeof(int));
+    if (indexMap == NULL) {
+        printf("No se pudo reservar memoria para el grafo.\n");
+        return -1;
+    }
+
+    //vectores de desplazamiento para los 4 vecinos (arriba, izquierda, derecha, abajo)
+    //en este orden los vecinos de cada vertice quedan con indices crecientes
+    int dr[4] = {-1, 0, 0, 1};
+    int dc[4] = {0, -1, 1, 0};
+
+    //primer recorrido: contar celdas transitables y entradas de adyacencia
     for (int r = 0; r < maze->rows; ++r) {
         for (int c = 0; c < maze->cols; ++c) {
-            indexMap[r][c] = -1; //inicializar como no transitable
+            indexMap[r * maze->cols + c] = -1; //inicializar como no transitable
             
-            //si la celda no es un muro, es transitable
-            if (maze->cells[r][c] != WALL) {
-                openCells++;
+            //si la celda es un muro, no aporta vertice
+            if (maze->cells[r][c] == WALL) {
+                continue;
+            }
+            openCells++;
+
+            //cada vecino transitable aporta una entrada en la lista de esta celda
+            for (int k = 0; k < 4; ++k) {
+                int nr = r + dr[k];
+                int nc = c + dc[k];
+                if (nr >= 0 && nr < maze->rows && nc >= 0 && nc < maze->cols && maze->cells[nr][nc] != WALL) {
+                    entradas++;
+                }
             }
         }
     }
@@ -146,22 +456,22 @@ int build_graph(const struct Maze* maze, struct Grafo* grafo, int* startIndex, i
     //validar que haya al menos una celda transitable
     if (openCells == 0) {
         printf("No hay celdas transitables en el laberinto.\n");
+        free(indexMap);
         return -1;
     }
 
     //liberar el grafo anterior y crear uno nuevo con el tamano correcto
     liberarGrafo(grafo);
-    struct Grafo* nuevo = crearGrafo(openCells);
+    struct Grafo* nuevo = crearGrafo(openCells, entradas);
     if (nuevo == NULL) {
         printf("No se pudo reservar memoria para el grafo.\n");
+        free(indexMap);
         return -1;
     }
     
     //transferir los punteros del nuevo grafo al grafo existente
-    grafo->vertices = nuevo->vertices;
-    grafo->peso = nuevo->peso;
-    grafo->indexToCoord = nuevo->indexToCoord;
-    free(nuevo); // liberar la estructura temporal, las matrices quedan en grafo
+    *grafo = *nuevo;
+    free(nuevo); // liberar la estructura temporal, los arreglos quedan en grafo
 
     //segundo recorrido: asignar indices a las celdas transitables
     int currentIndex = 0;
@@ -170,7 +480,7 @@ int build_graph(const struct Maze* maze, struct Grafo* grafo, int* startIndex, i
             //si la celda es transitable
             if (maze->cells[r][c] != WALL) {
                 //asignar el indice del vertice a esta posicion
-                indexMap[r][c] = currentIndex;
+                indexMap[r * maze->cols + c] = currentIndex;
                 
                 //guardar las coordenadas del vertice
                 grafo->indexToCoord[currentIndex].row = r;
@@ -187,19 +497,17 @@ int build_graph(const struct Maze* maze, struct Grafo* grafo, int* startIndex, i
         }
     }
 
-    //vectores de desplazamiento para los 4 vecinos (arriba, abajo, izquierda, derecha)
-    int dr[4] = {-1, 1, 0, 0};
-    int dc[4] = {0, 0, -1, 1};
-    
-    //tercer recorrido: crear aristas entre celdas adyacentes
+    //tercer recorrido: llenar la lista de vecinos de cada vertice en orden de indice
+    int entrada = 0;
     for (int r = 0; r < maze->rows; ++r) {
         for (int c = 0; c < maze->cols; ++c) {
-            int from = indexMap[r][c];
+            int from = indexMap[r * maze->cols + c];
             
             //si esta celda no es transitable, continuar
             if (from == -1) {
                 continue;
             }
+            grafo->offsets[from] = entrada;
             
             //revisar los 4 vecinos
             for (int k = 0; k < 4; ++k) {
@@ -211,15 +519,23 @@ int build_graph(const struct Maze* maze, struct Grafo* grafo, int* startIndex, i
                     continue;
                 }
                 
-                int to = indexMap[nr][nc];
+                int to = indexMap[nr * maze->cols + nc];
                 
-                //si el vecino es transitable, crear una arista con peso 1
+                //si el vecino es transitable, crear la entrada con el costo de entrar en el
                 if (to != -1) {
-                    grafo->peso[from][to] = 1;
+                    grafo->vecinos[entrada] = to;
+                    grafo->pesos[entrada] = cell_cost(maze->cells[nr][nc]);
+                    entrada++;
                 }
             }
         }
     }
+    grafo->offsets[grafo->vertices] = entrada;
+    free(indexMap);
+
+    //con terreno los pesos dejan de ser unitarios y simetricos
+    recalcularInvariantes(grafo);
+    etiquetarComponentes(grafo); //sin memoria las etiquetas quedan no vigentes y se busca igual
 
     //validar que se encontraron los puntos de inicio y meta
     if (*startIndex == -1 || *goalIndex == -1) {
@@ -232,82 +548,76 @@ int build_graph(const struct Maze* maze, struct Grafo* grafo, int* startIndex, i
 }
 
 /*
-E: puntero a grafo, cantidad de vertices (2-100), probabilidad de arista [0,1].
-S: crea matriz de pesos (1) aleatoria simetrica; retorna 0 si OK.
-R: memoria disponible; vertices en rango; edgeProb se ajusta a [0,1].
+E: puntero a grafo, cantidad de vertices (2 a MAX_VERTICES_ALEATORIO), probabilidad de arista [0,1].
+S: crea adyacencia aleatoria con pesos 1 sobre una cuadricula en O(vertices); retorna 0 si OK.
+R: memoria disponible; edgeProb se ajusta a [0,1]; usa el generador del hilo, asi que
+   sembrarAleatorioHilo con la misma semilla antes de llamar repite el mismo grafo.
 .*/
 int generate_random_graph(struct Grafo* grafo, int vertices, double edgeProb) {
     //validar que el numero de vertices este en un rango razonable
-    if (vertices < 2 || vertices > 100) {
-        printf("El numero de nodos debe estar entre 2 y 100.\n");
-        return -1;
-    }
-    
-    //ajustar la probabilidad al rango [0, 1]
-    if (edgeProb < 0.0) edgeProb = 0.0;
-    if (edgeProb > 1.0) edgeProb = 1.0;
-
-    //liberar el grafo anterior y crear uno nuevo
-    liberarGrafo(grafo);
-    struct Grafo* nuevo = crearGrafo(vertices);
-    if (nuevo == NULL) {
-        printf("No se pudo reservar memoria para el grafo aleatorio.\n");
+    if (vertices < 2 || vertices > MAX_VERTICES_ALEATORIO) {
+        printf("El numero de nodos debe estar entre 2 y %d.\n", MAX_VERTICES_ALEATORIO);
         return -1;
     }
     
-    //transferir los punteros del nuevo grafo al grafo existente
-    grafo->vertices = nuevo->vertices;
-    grafo->peso = nuevo->peso;
-    grafo->indexToCoord = nuevo->indexToCoord;
-    free(nuevo); //liberar la estructura temporal
+    //convertir la probabilidad (ajustada a [0, 1]) en un umbral entero para cada moneda
+    uint64_t umbral = umbralProbabilidad(edgeProb);
+    struct Aleatorio* gen = aleatorioHilo();
 
     //distribuir los nodos en una cuadricula logica
     //calcular dimensiones de la cuadricula (aproximadamente cuadrada)
     int gridCols = (int)(sqrt((double)vertices) + 0.5);
     if (gridCols < 1) gridCols = 1;
 
-    //asignar coordenadas a cada nodo en la cuadricula
-    for (int i = 0; i < vertices; ++i) {
-        grafo->indexToCoord[i].row = i / gridCols;
-        grafo->indexToCoord[i].col = i % gridCols;
+    //cada nodo tiene a lo sumo 2 aristas hacia vecinos con indice mayor (abajo y derecha)
+    struct Arista* aristas = calloc((size_t)vertices * 2, sizeof(struct Arista));
+    if (aristas == NULL) {
+        printf("No se pudo reservar memoria para el grafo aleatorio.\n");
+        return -1;
     }
+    int cantidad = 0;
 
     //generar aristas aleatorias SOLO entre nodos adyacentes en la cuadricula
     //esto asegura que el grafo corresponda al laberinto visual
     for (int i = 0; i < vertices; ++i) {
-        int iRow = grafo->indexToCoord[i].row;
-        int iCol = grafo->indexToCoord[i].col;
-
-        //revisar los 4 vecinos potenciales (arriba, abajo, izquierda, derecha)
-        int dr[4] = {-1, 1, 0, 0};
-        int dc[4] = {0, 0, -1, 1};
-
-        for (int dir = 0; dir < 4; ++dir) {
-            int neighborRow = iRow + dr[dir];
-            int neighborCol = iCol + dc[dir];
-
-            //buscar el nodo que corresponde a esta posicion adyacente
-            for (int j = 0; j < vertices; ++j) {
-                if (grafo->indexToCoord[j].row == neighborRow &&
-                    grafo->indexToCoord[j].col == neighborCol) {
-
-                    //evitar crear la arista dos veces
-                    if (i < j) {
-                        //generar numero aleatorio para decidir si crear la arista
-                        double r = (double)rand() / (double)RAND_MAX;
-
-                        if (r <= edgeProb) {
-                            //crear arista bidireccional con peso 1
-                            grafo->peso[i][j] = 1;
-                            grafo->peso[j][i] = 1;
-                        }
-                    }
-                    break;
-                }
+        int iCol = i % gridCols;
+
+        //vecino de abajo y vecino de la derecha (los de arriba/izquierda ya se revisaron)
+        int abajo = i + gridCols;
+        int derecha = (iCol + 1 < gridCols) ? i + 1 : vertices;
+        int candidatos[2] = {abajo, derecha};
+
+        for (int k = 0; k < 2; ++k) {
+            int j = candidatos[k];
+            if (j >= vertices) {
+                continue; //fuera de la cuadricula
+            }
+
+            //lanzar una moneda para decidir si crear la arista
+            if (aleatorioBernoulli(gen, umbral)) {
+                //crear arista bidireccional con peso 1
+                aristas[cantidad].origen = i;
+                aristas[cantidad].destino = j;
+                aristas[cantidad].peso = 1;
+                cantidad++;
             }
         }
     }
 
+    //construir la adyacencia comprimida (libera el grafo anterior)
+    int resultado = construirAdyacencia(grafo, vertices, aristas, cantidad);
+    free(aristas);
+    if (resultado != 0) {
+        printf("No se pudo reservar memoria para el grafo aleatorio.\n");
+        return -1;
+    }
+
+    //asignar coordenadas a cada nodo en la cuadricula
+    for (int i = 0; i < vertices; ++i) {
+        grafo->indexToCoord[i].row = i / gridCols;
+        grafo->indexToCoord[i].col = i % gridCols;
+    }
+
     return 0; //exito
 }
 
@@ -350,24 +660,13 @@ int build_maze_from_graph(struct Grafo* grafo, struct Maze* maze, int startIndex
     int mazeRows = maxRow * 2 + 3; //+3 para bordes superior e inferior y el nodo final
     int mazeCols = maxCol * 2 + 3; //+3 para bordes izquierdo y derecho y el nodo final
 
-    //validar que no exceda los limites
-    if (mazeRows > MAX_ROWS || mazeCols > MAX_COLS) {
-        printf("El laberinto generado excede las dimensiones maximas.\n");
+    //reservar las celdas del laberinto, inicializadas con muros
+    if (create_maze(maze, mazeRows, mazeCols) != 0) {
+        printf("No se pudo reservar memoria para el laberinto generado.\n");
         free(originalCoords);
         return -1;
     }
 
-    maze->rows = mazeRows;
-    maze->cols = mazeCols;
-
-    //inicializar todo con muros
-    for (int r = 0; r < mazeRows; ++r) {
-        for (int c = 0; c < mazeCols; ++c) {
-            maze->cells[r][c] = WALL;
-        }
-        maze->cells[r][mazeCols] = '\0';
-    }
-
     //colocar los nodos en el laberinto y actualizar sus coordenadas
     for (int i = 0; i < grafo->vertices; ++i) {
         int nodeRow = originalCoords[i].row;
@@ -398,9 +697,11 @@ int build_maze_from_graph(struct Grafo* grafo, struct Maze* maze, int startIndex
         int mazeFromRow = fromRow * 2 + 1;
         int mazeFromCol = fromCol * 2 + 1;
 
-        for (int j = i + 1; j < grafo->vertices; ++j) {
-            //si hay una arista entre i y j
-            if (grafo->peso[i][j] > 0) {
+        for (int e = grafo->offsets[i]; e < grafo->offsets[i + 1]; ++e) {
+            int j = grafo->vecinos[e];
+
+            //cada arista se dibuja una sola vez, desde el extremo con indice menor
+            if (j > i && grafo->pesos[e] > 0) {
                 int toRow = originalCoords[j].row;
                 int toCol = originalCoords[j].col;
                 int mazeToRow = toRow * 2 + 1;
@@ -430,6 +731,9 @@ int build_maze_from_graph(struct Grafo* grafo, struct Maze* maze, int startIndex
         maze->cells[r][mazeCols - 1] = '#';
     }
 
+    //las coordenadas se duplicaron: dos vecinos quedan ahora al doble de distancia
+    grafo->pasoCoordenadas *= 2;
+
     free(originalCoords);
     return 0;
 }
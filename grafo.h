@@ -3,21 +3,56 @@
 
 #include "laberinto.h"
 
-//representacion de grafo no dirigido con matriz de pesos
+//representacion de grafo no dirigido con adyacencia comprimida (CSR)
+//los vecinos del vertice v estan en vecinos[offsets[v]] .. vecinos[offsets[v + 1] - 1]
+//cada arista tiene una entrada en ambos extremos; sus pesos pueden diferir (terreno de laberintos)
 struct Grafo {
     int vertices; // numero de nodos
-    int** peso; // matriz de pesos, 0 o negativo indica que no hay arista
+    int entradas; // numero de entradas de adyacencia (2 por arista no dirigida)
+    int* offsets; // inicio de la lista de cada vertice, tamano vertices + 1
+    int* vecinos; // vertice destino de cada entrada, ordenados por vertice origen
+    int* pesos; // peso de cada entrada, 0 indica que la arista fue eliminada
     struct Point* indexToCoord; // indice a coordenada (para laberintos)
+    int pasoCoordenadas; // distancia Manhattan maxima entre las coordenadas de dos vecinos
+
+    //invariantes de los pesos, calculados al construir y mantenidos por asignarArista
+    //para que los algoritmos los consulten en O(1) sin recorrer las aristas
+    int pesosNoNegativos; // 1 si ningun peso es negativo
+    int pesoMinimo; // cota inferior de los pesos positivos (0 si no hay aristas)
+    int pesoMaximo; // cota superior de los pesos (0 si no hay aristas)
+    int entradasNoUnitarias; // entradas con peso distinto de 0 y de 1
+    int pesosSimetricos; // 1 si el peso de u->v es igual al de v->u en todas las aristas
+
+    //componentes conexas: dos vertices estan conectados si y solo si tienen la misma etiqueta
+    int* componente; // etiqueta 0 .. componentes-1 de cada vertice
+    int componentes; // cantidad de componentes
+    int componentesVigentes; // 0 si asignarArista pudo unir o separar componentes desde el ultimo etiquetado
+};
+
+//arista no dirigida usada para construir la adyacencia comprimida
+struct Arista {
+    int origen;
+    int destino;
+    int peso;
 };
 
 // funciones para crear, modificar y liberar grafos
-struct Grafo* crearGrafo(int vertices);
+struct Grafo* crearGrafo(int vertices, int entradas);
+int construirAdyacencia(struct Grafo* grafo, int vertices, const struct Arista* aristas, int cantidad);
 int asignarArista(struct Grafo* grafo, int origen, int destino, int peso);
+int pesoArista(const struct Grafo* grafo, int origen, int destino);
 void liberarGrafo(struct Grafo* grafo);
+void recalcularInvariantes(struct Grafo* grafo);
+int grafoPesosUnitarios(const struct Grafo* grafo);
+int etiquetarComponentes(struct Grafo* grafo);
+int mismaComponente(const struct Grafo* grafo, int a, int b);
 
-// construye grafo a partir de un laberinto; arma pesos 1 donde hay camino.
+// construye grafo a partir de un laberinto; el peso de u->v es el costo de la celda v.
 int build_graph(const struct Maze* maze, struct Grafo* grafo, int* startIndex, int* goalIndex);
 
+//limite de vertices del grafo aleatorio: el laberinto visual ocupa unas 4 celdas por vertice
+#define MAX_VERTICES_ALEATORIO 20000000
+
 // genera grafo aleatorio no dirigido con pesos 1 segun probabilidad.
 int generate_random_graph(struct Grafo* grafo, int vertices, double edgeProb);
 
@@ -0,0 +1,204 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "jps.h"
+#include "cuadricula.h"
+
+//en lugar de meter cada celda al heap, se avanza en linea recta mientras no aparezca
+//un vecino forzado; solo esas celdas (puntos de salto) entran a la cola de prioridad
+
+/*
+E: laberinto, celda de partida, direccion horizontal (+1/-1) y celda meta.
+S: retorna el siguiente punto de salto avanzando en la fila o -1 si se llega a un muro.
+R: dc distinto de 0.
+*/
+static int saltarHorizontal(const struct Maze *maze, int r, int c, int dc, int meta) {
+    while (grid_is_open(maze, r, c)) {
+        int celda = r * maze->cols + c;
+        if (celda == meta) {
+            return celda;
+        }
+
+        //vecino forzado: se abre una celda arriba/abajo que antes estaba tapada
+        if ((grid_is_open(maze, r - 1, c) && !grid_is_open(maze, r - 1, c - dc)) ||
+            (grid_is_open(maze, r + 1, c) && !grid_is_open(maze, r + 1, c - dc))) {
+            return celda;
+        }
+        c += dc;
+    }
+    return -1;
+}
+
+/*
+E: laberinto, celda de partida, direccion (dr, dc) y celda meta.
+S: retorna el siguiente punto de salto en esa direccion o -1 si no hay.
+R: exactamente uno de dr, dc es distinto de 0.
+*/
+static int saltar(const struct Maze *maze, int r, int c, int dr, int dc, int meta) {
+    if (dr == 0) {
+        return saltarHorizontal(maze, r, c, dc, meta);
+    }
+
+    while (grid_is_open(maze, r, c)) {
+        int celda = r * maze->cols + c;
+        if (celda == meta) {
+            return celda;
+        }
+
+        //vecino forzado al avanzar en vertical
+        if ((grid_is_open(maze, r, c - 1) && !grid_is_open(maze, r - dr, c - 1)) ||
+            (grid_is_open(maze, r, c + 1) && !grid_is_open(maze, r - dr, c + 1))) {
+            return celda;
+        }
+
+        //al moverse en vertical tambien hay que revisar los saltos horizontales
+        if (saltarHorizontal(maze, r, c + 1, 1, meta) != -1 || saltarHorizontal(maze, r, c - 1, -1, meta) != -1) {
+            return celda;
+        }
+        r += dr;
+    }
+    return -1;
+}
+
+/*
+Calcula el camino mas corto entre dos celdas con Jump Point Search.
+E: laberinto, celdas inicio y fin (indices fila * cols + col).
+S: retorna Camino con todas las celdas del recorrido (no solo los puntos de salto) o NULL si no hay ruta.
+R: todos los movimientos cuestan 1; expandidos cuenta los puntos de salto extraidos de la cola.
+*/
+struct Camino* jps_grid(const struct Maze *maze, int inicio, int fin) {
+    if (maze == NULL || maze->rows <= 0 || maze->cols <= 0) {
+        return NULL;
+    }
+
+    //espacio temporal; para consultas repetidas conviene reutilizar uno con jps_grid_espacio
+    struct EspacioBusqueda* espacio = crearEspacioBusqueda(maze->rows * maze->cols);
+    if (espacio == NULL) {
+        return NULL;
+    }
+    struct Camino* camino = jps_grid_espacio(maze, inicio, fin, espacio);
+    liberarEspacioBusqueda(espacio);
+    return camino;
+}
+
+/*
+Jump Point Search sin reservar memoria por consulta: usa los arreglos y la cola del espacio.
+E: laberinto, celdas inicio y fin (indices fila * cols + col), espacio de busqueda.
+S: retorna Camino con todas las celdas del recorrido o NULL si no hay ruta;
+   espacio->parent conserva el punto de salto anterior de cada punto alcanzado.
+R: espacio con capacidad >= rows*cols; todos los movimientos cuestan 1.
+*/
+struct Camino* jps_grid_espacio(const struct Maze *maze, int inicio, int fin, struct EspacioBusqueda* espacio) {
+    if (maze == NULL || maze->rows <= 0 || maze->cols <= 0) {
+        return NULL;
+    }
+    int n = maze->rows * maze->cols;
+    if (inicio < 0 || fin < 0 || inicio >= n || fin >= n || espacio == NULL || espacio->capacidad < n) {
+        return NULL;
+    }
+
+    int cols = maze->cols;
+    int metaRow = fin / cols;
+    int metaCol = fin % cols;
+
+    //val = costo g hasta cada punto de salto, parent = punto de salto anterior,
+    //visitado = puntos de salto ya expandidos
+    struct ColaPrioridad* cola = colaDeEspacio(espacio, COLA_HEAP_BINARIO, 1);
+    if (cola == NULL) {
+        return NULL;
+    }
+    cola->traza = NULL;
+    nuevaConsulta(espacio);
+    espacioAsignarValor(espacio, inicio, 0);
+    espacio->parent[inicio] = -1;
+    insertarCola(cola, inicio, abs(inicio / cols - metaRow) + abs(inicio % cols - metaCol));
+
+    //direcciones: arriba, izquierda, derecha, abajo
+    static const int dr[4] = {-1, 0, 0, 1};
+    static const int dc[4] = {0, -1, 1, 0};
+
+    int expandidos = 0;
+    while (cola->tamano > 0) {
+        int v = extraerMinimo(cola).vertice;
+        if (v == -1) {
+            break;
+        }
+        if (espacioVisitado(espacio, v)) {
+            continue;
+        }
+        espacioMarcarVisitado(espacio, v);
+        expandidos++;
+        if (v == fin) {
+            break;
+        }
+
+        int r = v / cols;
+        int c = v % cols;
+
+        //vecinos podados: sin padre se prueban las 4 direcciones;
+        //con padre, se sigue de frente y se prueban las dos perpendiculares
+        int desde = espacio->parent[v];
+        for (int k = 0; k < 4; ++k) {
+            if (desde != -1) {
+                int pr = desde / cols;
+                int pc = desde % cols;
+                int mr = (r > pr) - (r < pr);
+                int mc = (c > pc) - (c < pc);
+                if (dr[k] == -mr && dc[k] == -mc) {
+                    continue; //no se regresa por donde se vino
+                }
+            }
+
+            int salto = saltar(maze, r + dr[k], c + dc[k], dr[k], dc[k], fin);
+            if (salto == -1 || espacioVisitado(espacio, salto)) {
+                continue;
+            }
+
+            //el punto de salto esta en linea recta: su costo es la distancia recorrida
+            int sr = salto / cols;
+            int sc = salto % cols;
+            int nuevoVal = espacio->val[v] + abs(sr - r) + abs(sc - c);
+            if (!espacioTieneValor(espacio, salto) || nuevoVal < espacio->val[salto]) {
+                espacioAsignarValor(espacio, salto, nuevoVal);
+                espacio->parent[salto] = v;
+                insertarCola(cola, salto, nuevoVal + abs(sr - metaRow) + abs(sc - metaCol));
+            }
+        }
+    }
+
+    struct Camino* camino = NULL;
+    if (espacioVisitado(espacio, fin)) {
+        int valFin = espacio->val[fin];
+        //expandir los puntos de salto a la secuencia completa de celdas
+        camino = calloc(1, sizeof(struct Camino));
+        if (camino != NULL) {
+            camino->longitud = valFin + 1;
+            camino->valorTotal = valFin;
+            camino->expandidos = expandidos;
+            camino->nodos = calloc(camino->longitud, sizeof(int));
+            if (camino->nodos == NULL) {
+                free(camino);
+                camino = NULL;
+            }
+        }
+        if (camino != NULL) {
+            //recorrer de la meta al inicio llenando el arreglo de atras hacia adelante
+            int pos = camino->longitud - 1;
+            int actual = fin;
+            camino->nodos[pos] = actual;
+            while (actual != inicio) {
+                int anterior = espacio->parent[actual];
+                int paso = (anterior / cols == actual / cols) ? ((anterior > actual) ? 1 : -1)
+                                                              : ((anterior > actual) ? cols : -cols);
+                for (int celda = actual + paso; ; celda += paso) {
+                    camino->nodos[--pos] = celda;
+                    if (celda == anterior) {
+                        break;
+                    }
+                }
+                actual = anterior;
+            }
+        }
+    }
+    return camino;
+}
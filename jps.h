@@ -0,0 +1,11 @@
+#ifndef JPS_H
+#define JPS_H
+
+#include "laberinto.h"
+#include "dijkstra.h"
+
+//Jump Point Search para laberintos de costo uniforme con 4 vecinos
+struct Camino* jps_grid(const struct Maze *maze, int inicio, int fin);
+struct Camino* jps_grid_espacio(const struct Maze *maze, int inicio, int fin, struct EspacioBusqueda* espacio);
+
+#endif
@@ -1,7 +1,17 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include "laberinto.h"
 
 /*
@@ -26,21 +36,71 @@ void trim_newline(char *s) {
 }
 
 /*
-E: ruta de archivo de laberinto y puntero Maze.
-S: carga celdas, filas y columnas; retorna 0 si OK, -1 si error.
-R: archivo legible, filas con la misma longitud, maximo 128x128.
+E: caracter de una celda.
+S: costo de entrar en la celda: el valor del digito para '1'..'9', 1 para el resto de transitables, 0 para muro.
+R: ninguna; el costo nunca supera MAX_CELL_COST.
 .*/
-int load_maze(const char *filename, struct Maze *maze) {
-    //intentar abrir el archivo en modo lectura
-    FILE *f = fopen(filename, "r");
-    if (f == NULL) {
-        perror("No se pudo abrir el archivo");
+int cell_cost(char cell) {
+    if (cell == WALL) {
+        return 0;
+    }
+    if (cell >= '1' && cell <= '9') {
+        return cell - '0';
+    }
+    return 1;
+}
+
+/*
+E: puntero Maze y dimensiones positivas.
+S: reserva un bloque contiguo de rows x cols celdas lleno de muros; 0 si OK, -1 si error.
+R: libera el contenido anterior del laberinto; rows*cols debe caber en un int.
+.*/
+int create_maze(struct Maze *maze, int rows, int cols) {
+    if (maze == NULL || rows <= 0 || cols <= 0 || (long long)rows * cols > INT_MAX) {
+        return -1;
+    }
+
+    //un byte extra por fila para dejar cada fila terminada en '\0'
+    size_t stride = (size_t)cols + 1;
+    char *buffer = malloc((size_t)rows * stride);
+    char **cells = malloc((size_t)rows * sizeof(char *));
+    if (buffer == NULL || cells == NULL) {
+        free(buffer);
+        free(cells);
+        return -1;
+    }
+
+    //inicializar todo con muros
+    for (int r = 0; r < rows; ++r) {
+        cells[r] = buffer + (size_t)r * stride;
+        memset(cells[r], WALL, cols);
+        cells[r][cols] = '\0';
+    }
+
+    free_maze(maze);
+    maze->rows = rows;
+    maze->cols = cols;
+    maze->cells = cells;
+    maze->buffer = buffer;
+    maze->bufferSize = (size_t)rows * stride;
+    maze->mapped = 0;
+    return 0;
+}
+
+/*
+E: bloque con el contenido del archivo, su tamano y puntero Maze.
+S: indexa las filas dentro del bloque sin copiar ni modificar bytes; 0 si OK, -1 si error.
+R: el bloque debe seguir vivo mientras se use el laberinto; filas con la misma longitud.
+.*/
+static int index_maze_rows(char *data, size_t size, struct Maze *maze) {
+    //indice de filas que crece al doble cuando se llena (una sola pasada sobre los bytes)
+    size_t capacity = 64;
+    char **cells = malloc(capacity * sizeof(char *));
+    if (cells == NULL) {
+        printf("No se pudo reservar memoria para el laberinto.\n");
         return -1;
     }
 
-    //buffer temporal para leer cada linea del archivo
-    char buffer[MAX_COLS + 4];
-    
     //contador de filas procesadas
     int row = 0;
     
@@ -48,61 +108,400 @@ int load_maze(const char *filename, struct Maze *maze) {
     //esto asegura que todas las filas tengan la misma longitud
     int expectedCols = -1;
 
-    //leer el archivo linea por linea
-    while (fgets(buffer, sizeof(buffer), f) != NULL) {
-        //eliminar el caracter de nueva linea al final
-        trim_newline(buffer);
-        
-        //obtener la longitud de la linea leida
-        size_t len = strlen(buffer);
+    //recorrer el bloque linea por linea; cada fila apunta al bloque original
+    char *p = data;
+    char *end = data + size;
+    while (p < end) {
+        char *newline = memchr(p, '\n', (size_t)(end - p));
+        char *lineEnd = (newline != NULL) ? newline : end;
+
+        //descontar el salto de linea (incluye '\r' de archivos Windows) sin escribir en el bloque
+        size_t len = (size_t)(lineEnd - p);
+        while (len > 0 && p[len - 1] == '\r') {
+            len--;
+        }
+        char *line = p;
+        p = (newline != NULL) ? newline + 1 : end;
         
         //ignorar lineas vacias (pueden aparecer en el archivo)
         if (len == 0) {
             continue;
         }
         
-        //validar que la linea no exceda el maximo de columnas permitido
-        if ((int)len > MAX_COLS) {
-            printf("Linea %d excede el maximo de columnas (%d)\n", row + 1, MAX_COLS);
-            fclose(f);
-            return -1;
-        }
-        
         //en la primera fila valida, establecer el numero esperado de columnas
         if (expectedCols == -1) {
+            if (len > (size_t)INT_MAX) {
+                printf("Linea %d es demasiado larga.\n", row + 1);
+                free(cells);
+                return -1;
+            }
             expectedCols = (int)len;
         } 
         //en filas subsecuentes, verificar que tengan la misma longitud
-        else if ((int)len != expectedCols) {
+        else if (len != (size_t)expectedCols) {
             printf("Las lineas deben tener la misma longitud. Linea %d tiene %zu en lugar de %d.\n", row + 1, len, expectedCols);
-            fclose(f);
+            free(cells);
             return -1;
         }
-        
-        //validar que no se exceda el maximo de filas
-        if (row >= MAX_ROWS) {
-            printf("Numero de filas excede el maximo permitido (%d).\n", MAX_ROWS);
-            fclose(f);
+
+        //las celdas se identifican con un int, el total debe caber en ese rango
+        if ((long long)(row + 1) * expectedCols > INT_MAX) {
+            printf("El laberinto es demasiado grande (%d filas de %d columnas).\n", row + 1, expectedCols);
+            free(cells);
             return -1;
         }
+
+        //agrandar el indice de filas si hace falta
+        if ((size_t)row == capacity) {
+            capacity *= 2;
+            char **grown = realloc(cells, capacity * sizeof(char *));
+            if (grown == NULL) {
+                printf("No se pudo reservar memoria para el laberinto.\n");
+                free(cells);
+                return -1;
+            }
+            cells = grown;
+        }
         
-        //copiar la linea al arreglo de celdas del laberinto
-        strcpy(maze->cells[row], buffer);
-        row++;
+        cells[row++] = line;
     }
 
-    //cerrar el archivo
-    fclose(f);
-
     //validar que se haya leido al menos una fila
     if (row == 0) {
         printf("El archivo esta vacio o no tiene filas validas.\n");
+        free(cells);
         return -1;
     }
 
-    //establecer las dimensiones finales del laberinto
     maze->rows = row;
     maze->cols = expectedCols;
+    maze->cells = cells;
+    return 0;
+}
+
+/*
+E: archivo abierto y puntero para el tamano.
+S: retorna el contenido completo en un bloque reservado o NULL en error.
+R: archivo con posicion al inicio; respaldo cuando no se puede mapear.
+.*/
+static char *read_whole_file(FILE *f, size_t *size) {
+    if (fseek(f, 0, SEEK_END) != 0) {
+        return NULL;
+    }
+    long fileSize = ftell(f);
+    if (fileSize < 0 || fseek(f, 0, SEEK_SET) != 0) {
+        return NULL;
+    }
+
+    //unica reserva para las celdas (al menos 1 byte para archivos vacios)
+    char *buffer = malloc((size_t)fileSize + 1);
+    if (buffer == NULL) {
+        return NULL;
+    }
+    if (fread(buffer, 1, (size_t)fileSize, f) != (size_t)fileSize) {
+        free(buffer);
+        return NULL;
+    }
+    *size = (size_t)fileSize;
+    return buffer;
+}
+
+//formato binario: encabezado de 32 bytes (enteros de 32 bits little-endian)
+//  "LABB", version, filas, columnas, fila/col de I, fila/col de F (-1 si falta)
+//seguido de un bit por celda en orden fila-mayor (1 = muro, 0 = transitable)
+#define MAZE_BIN_MAGIC "LABB"
+#define MAZE_BIN_VERSION 1
+#define MAZE_BIN_HEADER 32
+
+/*
+E: bloque de bytes y desplazamiento.
+S: retorna el entero de 32 bits little-endian en esa posicion.
+R: al menos 4 bytes disponibles desde offset.
+*/
+static int read_le32(const unsigned char *data, size_t offset) {
+    unsigned int value = (unsigned int)data[offset]
+        | ((unsigned int)data[offset + 1] << 8)
+        | ((unsigned int)data[offset + 2] << 16)
+        | ((unsigned int)data[offset + 3] << 24);
+    return (int)value;
+}
+
+/*
+E: arreglo destino, desplazamiento y valor.
+S: escribe el valor como entero de 32 bits little-endian.
+R: al menos 4 bytes disponibles desde offset.
+*/
+static void write_le32(unsigned char *data, size_t offset, int value) {
+    unsigned int v = (unsigned int)value;
+    data[offset] = (unsigned char)(v & 0xFF);
+    data[offset + 1] = (unsigned char)((v >> 8) & 0xFF);
+    data[offset + 2] = (unsigned char)((v >> 16) & 0xFF);
+    data[offset + 3] = (unsigned char)((v >> 24) & 0xFF);
+}
+
+/*
+E: bloque de bytes y su tamano.
+S: retorna 1 si el bloque empieza con el encabezado del formato binario.
+R: ninguna.
+*/
+static int is_maze_binary(const void *data, size_t size) {
+    return size >= MAZE_BIN_HEADER && memcmp(data, MAZE_BIN_MAGIC, 4) == 0;
+}
+
+/*
+E: bloque en formato binario, su tamano y puntero Maze.
+S: expande un bit por celda a 'X'/'.' y coloca I y F; 0 si OK, -1 si el bloque es invalido.
+R: solo reemplaza el laberinto si la lectura fue exitosa.
+*/
+static int unpack_maze_binary(const unsigned char *data, size_t size, struct Maze *maze) {
+    int version = read_le32(data, 4);
+    int rows = read_le32(data, 8);
+    int cols = read_le32(data, 12);
+    struct Point start = {read_le32(data, 16), read_le32(data, 20)};
+    struct Point goal = {read_le32(data, 24), read_le32(data, 28)};
+
+    if (version != MAZE_BIN_VERSION || rows <= 0 || cols <= 0 || (long long)rows * cols > INT_MAX) {
+        printf("Encabezado de laberinto binario invalido.\n");
+        return -1;
+    }
+    size_t cells = (size_t)rows * cols;
+    if (size - MAZE_BIN_HEADER < (cells + 7) / 8) {
+        printf("El archivo binario esta incompleto.\n");
+        return -1;
+    }
+
+    struct Maze unpacked = {0};
+    if (create_maze(&unpacked, rows, cols) != 0) {
+        printf("No se pudo reservar memoria para el laberinto.\n");
+        return -1;
+    }
+
+    //expandir los bits fila por fila
+    const unsigned char *bits = data + MAZE_BIN_HEADER;
+    size_t bit = 0;
+    for (int r = 0; r < rows; ++r) {
+        char *row = unpacked.cells[r];
+        for (int c = 0; c < cols; ++c, ++bit) {
+            row[c] = ((bits[bit >> 3] >> (bit & 7)) & 1) ? WALL : '.';
+        }
+    }
+
+    //colocar inicio y meta si estan dentro del laberinto
+    if (start.row >= 0 && start.row < rows && start.col >= 0 && start.col < cols) {
+        unpacked.cells[start.row][start.col] = START;
+    }
+    if (goal.row >= 0 && goal.row < rows && goal.col >= 0 && goal.col < cols) {
+        unpacked.cells[goal.row][goal.col] = END;
+    }
+
+    free_maze(maze);
+    *maze = unpacked;
+    return 0;
+}
+
+/*
+E: ruta de archivo de laberinto (texto o binario) y puntero Maze.
+S: carga celdas, filas y columnas; retorna 0 si OK, -1 si error.
+R: archivo legible, filas con la misma longitud; rows*cols debe caber en un int.
+.*/
+int load_maze(const char *filename, struct Maze *maze) {
+    struct Maze loaded = {0};
+
+#ifndef _WIN32
+    //camino principal: mapear el archivo y apuntar las filas al cache de paginas
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) {
+        perror("No se pudo abrir el archivo");
+        return -1;
+    }
+    struct stat info;
+    if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0) {
+        size_t size = (size_t)info.st_size;
+
+        //MAP_PRIVATE: si luego se modifica una celda, solo esa pagina se copia
+        void *data = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED) {
+            close(fd);
+            posix_madvise(data, size, POSIX_MADV_SEQUENTIAL);
+
+            //los archivos binarios se expanden a celdas y el mapeo se descarta
+            if (is_maze_binary(data, size)) {
+                int result = unpack_maze_binary(data, size, maze);
+                munmap(data, size);
+                return result;
+            }
+
+            if (index_maze_rows(data, size, &loaded) != 0) {
+                munmap(data, size);
+                return -1;
+            }
+
+            //reemplazar el laberinto anterior solo cuando la carga fue exitosa
+            loaded.buffer = data;
+            loaded.bufferSize = size;
+            loaded.mapped = 1;
+            free_maze(maze);
+            *maze = loaded;
+            return 0; //exito
+        }
+    }
+    close(fd);
+#endif
+
+    //respaldo: leer el archivo completo en un solo bloque
+    FILE *f = fopen(filename, "rb");
+    if (f == NULL) {
+        perror("No se pudo abrir el archivo");
+        return -1;
+    }
+    size_t size = 0;
+    char *buffer = read_whole_file(f, &size);
+    fclose(f);
+    if (buffer == NULL) {
+        printf("No se pudo leer el archivo completo.\n");
+        return -1;
+    }
+    if (is_maze_binary(buffer, size)) {
+        int result = unpack_maze_binary((const unsigned char *)buffer, size, maze);
+        free(buffer);
+        return result;
+    }
+    if (index_maze_rows(buffer, size, &loaded) != 0) {
+        free(buffer);
+        return -1;
+    }
+
+    //reemplazar el laberinto anterior solo cuando la carga fue exitosa
+    loaded.buffer = buffer;
+    loaded.bufferSize = size;
+    loaded.mapped = 0;
+    free_maze(maze);
+    *maze = loaded;
     
     return 0; //exito
 }
+
+/*
+E: ruta de salida y laberinto cargado.
+S: escribe el laberinto en formato de texto (una linea por fila); 0 si OK, -1 si error.
+R: laberinto con rows y cols positivos.
+.*/
+int save_maze_text(const char *filename, const struct Maze *maze) {
+    if (maze == NULL || maze->rows <= 0 || maze->cols <= 0) {
+        return -1;
+    }
+
+    FILE *f = fopen(filename, "wb");
+    if (f == NULL) {
+        perror("No se pudo crear el archivo");
+        return -1;
+    }
+
+    //buffer grande para escribir filas completas con pocas llamadas al sistema
+    setvbuf(f, NULL, _IOFBF, 1 << 20);
+    int ok = 1;
+    for (int r = 0; r < maze->rows && ok; ++r) {
+        ok = fwrite(maze->cells[r], 1, (size_t)maze->cols, f) == (size_t)maze->cols && fputc('\n', f) != EOF;
+    }
+
+    if (fclose(f) != 0 || !ok) {
+        printf("No se pudo escribir el archivo.\n");
+        return -1;
+    }
+    return 0;
+}
+
+/*
+E: ruta de salida y laberinto cargado.
+S: escribe el laberinto en formato binario de un bit por celda; 0 si OK, -1 si error.
+R: solo se conserva muro/transitable e I/F; otros caracteres se leen de vuelta como '.';
+   se rechazan laberintos con celdas de terreno de costo mayor a 1 (usar formato texto).
+.*/
+int save_maze_binary(const char *filename, const struct Maze *maze) {
+    if (maze == NULL || maze->rows <= 0 || maze->cols <= 0) {
+        return -1;
+    }
+
+    size_t cells = (size_t)maze->rows * maze->cols;
+    size_t size = MAZE_BIN_HEADER + (cells + 7) / 8;
+    unsigned char *data = calloc(size, 1);
+    if (data == NULL) {
+        printf("No se pudo reservar memoria para el archivo binario.\n");
+        return -1;
+    }
+
+    //empaquetar un bit por celda y ubicar inicio/meta en la misma pasada
+    struct Point start = {-1, -1};
+    struct Point goal = {-1, -1};
+    unsigned char *bits = data + MAZE_BIN_HEADER;
+    size_t bit = 0;
+    for (int r = 0; r < maze->rows; ++r) {
+        const char *row = maze->cells[r];
+        for (int c = 0; c < maze->cols; ++c, ++bit) {
+            if (row[c] == WALL) {
+                bits[bit >> 3] |= (unsigned char)(1u << (bit & 7));
+            } else if (cell_cost(row[c]) > 1) {
+                printf("El formato binario no guarda costos de terreno; guarde el laberinto en texto.\n");
+                free(data);
+                return -1;
+            } else if (row[c] == START) {
+                start.row = r;
+                start.col = c;
+            } else if (row[c] == END) {
+                goal.row = r;
+                goal.col = c;
+            }
+        }
+    }
+
+    memcpy(data, MAZE_BIN_MAGIC, 4);
+    write_le32(data, 4, MAZE_BIN_VERSION);
+    write_le32(data, 8, maze->rows);
+    write_le32(data, 12, maze->cols);
+    write_le32(data, 16, start.row);
+    write_le32(data, 20, start.col);
+    write_le32(data, 24, goal.row);
+    write_le32(data, 28, goal.col);
+
+    FILE *f = fopen(filename, "wb");
+    if (f == NULL) {
+        perror("No se pudo crear el archivo");
+        free(data);
+        return -1;
+    }
+    int ok = fwrite(data, 1, size, f) == size;
+    if (fclose(f) != 0 || !ok) {
+        printf("No se pudo escribir el archivo.\n");
+        free(data);
+        return -1;
+    }
+    free(data);
+    return 0;
+}
+
+/*
+E: puntero Maze.
+S: libera las celdas y deja el laberinto vacio.
+R: maze puede estar vacio (inicializado en 0).
+.*/
+void free_maze(struct Maze *maze) {
+    if (maze == NULL) {
+        return;
+    }
+    free(maze->cells);
+#ifndef _WIN32
+    if (maze->mapped) {
+        munmap(maze->buffer, maze->bufferSize);
+    } else {
+        free(maze->buffer);
+    }
+#else
+    free(maze->buffer);
+#endif
+    maze->cells = NULL;
+    maze->buffer = NULL;
+    maze->bufferSize = 0;
+    maze->mapped = 0;
+    maze->rows = 0;
+    maze->cols = 0;
+}
@@ -3,24 +3,36 @@
 
 #include <stddef.h>
 
-#define MAX_ROWS 128
-#define MAX_COLS 128
 #define WALL 'X'
 #define START 'I'
 #define END 'F'
 
+//celdas de terreno: un digito '1'..'9' es transitable y entrar en ella cuesta su valor
+//(muro 'X' no se puede entrar; '.', espacio, 'I' y 'F' cuestan 1)
+#define MAX_CELL_COST 9
+
 struct Point {
     int row;
     int col;
 } ;
 
+//las celdas viven en un solo bloque contiguo; cells[r] apunta al inicio de la fila r
+//cada fila tiene exactamente cols caracteres validos y no termina necesariamente en '\0'
 struct Maze {
     int rows;
     int cols;
-    char cells[MAX_ROWS][MAX_COLS + 1];
+    char **cells; // punteros a cada fila dentro de buffer
+    char *buffer; // almacenamiento contiguo de todas las celdas (o archivo mapeado)
+    size_t bufferSize; // bytes de buffer
+    int mapped; // 1 si buffer es un mapeo del archivo (mmap), 0 si es memoria reservada
 } ;
 
 void trim_newline(char *s);
+int cell_cost(char cell);
+int create_maze(struct Maze *maze, int rows, int cols);
 int load_maze(const char *filename, struct Maze *maze);
+int save_maze_text(const char *filename, const struct Maze *maze);
+int save_maze_binary(const char *filename, const struct Maze *maze);
+void free_maze(struct Maze *maze);
 
 #endif
@@ -0,0 +1,165 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "lote.h"
+
+//cada hilo toma bloques de consultas de un contador compartido; los bloques
+//evitan que todos los hilos compitan por el contador en cada consulta
+#define CONSULTAS_POR_BLOQUE 16
+
+//datos compartidos por todos los hilos de un lote (el grafo solo se lee)
+struct TrabajoLote {
+    const struct Grafo* grafo;
+    const struct ConsultaLote* consultas;
+    struct ResultadoLote* resultados;
+    int cantidad;
+    int conCaminos;
+    struct OpcionesDijkstra opciones;
+    atomic_int siguiente; //primera consulta que nadie ha tomado
+    atomic_int fallos; //hilos que no pudieron reservar su espacio de busqueda
+};
+
+/*
+E: puntero a TrabajoLote.
+S: resuelve bloques de consultas con su propio espacio de busqueda hasta agotar el lote.
+R: cada resultado lo escribe un solo hilo; el grafo no se modifica mientras dura el lote.
+*/
+static void* trabajadorLote(void* arg) {
+    struct TrabajoLote* trabajo = arg;
+
+    //espacio propio del hilo: ningun arreglo de busqueda se comparte
+    struct EspacioBusqueda* espacio = crearEspacioBusqueda(trabajo->grafo->vertices);
+    if (espacio == NULL) {
+        atomic_fetch_add(&trabajo->fallos, 1);
+        return NULL;
+    }
+
+    while (1) {
+        int desde = atomic_fetch_add(&trabajo->siguiente, CONSULTAS_POR_BLOQUE);
+        if (desde >= trabajo->cantidad) {
+            break;
+        }
+        int hasta = desde + CONSULTAS_POR_BLOQUE;
+        if (hasta > trabajo->cantidad) {
+            hasta = trabajo->cantidad;
+        }
+
+        for (int i = desde; i < hasta; ++i) {
+            const struct ConsultaLote* consulta = &trabajo->consultas[i];
+            struct Camino* camino = dijkstraConEspacio(trabajo->grafo, consulta->inicio, consulta->fin, &trabajo->opciones, espacio);
+            trabajo->resultados[i].valor = (camino != NULL) ? camino->valorTotal : -1;
+            if (trabajo->conCaminos) {
+                trabajo->resultados[i].camino = camino;
+            } else {
+                liberarCamino(camino);
+                trabajo->resultados[i].camino = NULL;
+            }
+        }
+    }
+
+    liberarEspacioBusqueda(espacio);
+    return NULL;
+}
+
+/*
+E: ninguna.
+S: retorna la cantidad de nucleos en linea (al menos 1).
+R: ninguna.
+*/
+int hilosDisponibles(void) {
+#ifdef _SC_NPROCESSORS_ONLN
+    long nucleos = sysconf(_SC_NPROCESSORS_ONLN);
+    return (nucleos > 0) ? (int)nucleos : 1;
+#else
+    return 1; //sin forma portable de consultarlo; el llamador puede pedir mas hilos
+#endif
+}
+
+/*
+E: grafo de solo lectura, arreglo de consultas y su cantidad, hilos (<= 0 = todos los nucleos),
+   conCaminos (1 = guardar cada Camino, 0 = solo valores), opciones de Dijkstra (NULL = por defecto)
+   y arreglo de resultados del mismo tamano que las consultas.
+S: resuelve todas las consultas repartidas entre hilos; 0 si OK, -1 si ningun hilo pudo trabajar.
+R: el grafo no se modifica durante la llamada; el observador y la traza de las opciones se ignoran
+   (no son seguros entre hilos); liberar caminos con liberarResultadosLote.
+*/
+int resolverLote(const struct Grafo* grafo, const struct ConsultaLote* consultas, int cantidad,
+                 int hilos, int conCaminos, const struct OpcionesDijkstra* opciones, struct ResultadoLote* resultados) {
+    if (grafo == NULL || grafo->vertices <= 0 || cantidad < 0 || (cantidad > 0 && (consultas == NULL || resultados == NULL))) {
+        return -1;
+    }
+    if (cantidad == 0) {
+        return 0;
+    }
+
+    //no tiene sentido abrir mas hilos que bloques de consultas
+    if (hilos <= 0) {
+        hilos = hilosDisponibles();
+    }
+    int bloques = (cantidad + CONSULTAS_POR_BLOQUE - 1) / CONSULTAS_POR_BLOQUE;
+    if (hilos > bloques) {
+        hilos = bloques;
+    }
+
+    struct TrabajoLote trabajo;
+    trabajo.grafo = grafo;
+    trabajo.consultas = consultas;
+    trabajo.resultados = resultados;
+    trabajo.cantidad = cantidad;
+    trabajo.conCaminos = conCaminos;
+    trabajo.opciones.tipoCola = (opciones != NULL) ? opciones->tipoCola : COLA_HEAP_BINARIO;
+    trabajo.opciones.traza = NULL;
+    trabajo.opciones.observador.expandido = NULL;
+    trabajo.opciones.observador.contexto = NULL;
+    atomic_init(&trabajo.siguiente, 0);
+    atomic_init(&trabajo.fallos, 0);
+
+    for (int i = 0; i < cantidad; ++i) {
+        resultados[i].valor = -1;
+        resultados[i].camino = NULL;
+    }
+
+    //el hilo que llama tambien trabaja, asi que se crean hilos - 1 adicionales
+    pthread_t* ids = malloc((size_t)hilos * sizeof(pthread_t));
+    int creados = 0;
+    if (ids != NULL) {
+        for (int h = 1; h < hilos; ++h) {
+            if (pthread_create(&ids[creados], NULL, trabajadorLote, &trabajo) != 0) {
+                break; //seguir con los hilos que si se crearon
+            }
+            creados++;
+        }
+    }
+
+    trabajadorLote(&trabajo);
+    for (int h = 0; h < creados; ++h) {
+        pthread_join(ids[h], NULL);
+    }
+    free(ids);
+
+    //si todos los hilos fallaron al reservar memoria, quedaron consultas sin resolver
+    if (atomic_load(&trabajo.fallos) == creados + 1) {
+        return -1;
+    }
+    return 0;
+}
+
+/*
+E: arreglo de resultados de resolverLote y su cantidad.
+S: libera los caminos guardados y los deja en NULL (el arreglo es del llamador).
+R: resultados puede ser NULL.
+*/
+void liberarResultadosLote(struct ResultadoLote* resultados, int cantidad) {
+    if (resultados == NULL) {
+        return;
+    }
+    for (int i = 0; i < cantidad; ++i) {
+        liberarCamino(resultados[i].camino);
+        resultados[i].camino = NULL;
+    }
+}
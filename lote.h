@@ -0,0 +1,25 @@
+#ifndef LOTE_H
+#define LOTE_H
+
+#include "grafo.h"
+#include "dijkstra.h"
+
+//consulta (inicio, meta) para resolver en lote
+struct ConsultaLote {
+    int inicio;
+    int fin;
+};
+
+//resultado de una consulta del lote
+struct ResultadoLote {
+    int valor; //valor del camino minimo o -1 si no hay ruta/indices invalidos
+    struct Camino* camino; //camino completo (solo si se pidio); liberar con liberarResultadosLote
+};
+
+// funciones de consultas en lote
+int resolverLote(const struct Grafo* grafo, const struct ConsultaLote* consultas, int cantidad,
+                 int hilos, int conCaminos, const struct OpcionesDijkstra* opciones, struct ResultadoLote* resultados);
+int hilosDisponibles(void);
+void liberarResultadosLote(struct ResultadoLote* resultados, int cantidad);
+
+#endif
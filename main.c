@@ -1,14 +1,32 @@
-﻿#include <stdio.h>
+﻿#include <limits.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <time.h>
 
 //headers de los modulos del proyecto
+#include "aleatorio.h"     //generador xoshiro256** por hilo con semilla repetible
+#include "alt.h"           //oraculo de landmarks (ALT) para consultas repetidas
+#include "astar.h"         //busqueda A* con heuristica Manhattan
 #include "bfs.h"           //algoritmo de busqueda en amplitud
+#include "bidireccional.h" //BFS y Dijkstra desde ambos extremos
+#include "contraccion.h"   //jerarquia de contraccion para consultas punto a punto
+#include "cuadricula.h"    //busquedas implicitas sobre las celdas del laberinto
+#include "delta_stepping.h" //caminos minimos en paralelo por cubetas de distancia
 #include "dijkstra.h"      //algoritmo de Dijkstra para camino mas corto
+#include "exportacion.h"   //exportacion dispersa (lista de aristas, Matrix Market, DIMACS)
+#include "generador.h"     //laberintos perfectos (backtracker, Kruskal, Wilson)
 #include "grafo.h"         //estructura y funciones para manejar grafos
+#include "jps.h"           //Jump Point Search sobre la cuadricula
 #include "laberinto.h"     //carga y representacion de laberintos
+#include "lote.h"          //consultas en lote con varios hilos
+#include "reloj.h"         //tiempo de pared para las mediciones
+#include "replanificacion.h" //replanificacion incremental (LPA*) al cambiar celdas
+#include "medicion_colas.h" //microbenchmark de colas de prioridad con trazas
 #include "visualizacion.h" //funciones para imprimir resultados
 
+//los grafos aleatorios mas grandes no se dibujan: la animacion imprime el laberinto en cada paso
+#define MAX_NODOS_DIBUJO 2500
+
 //muestra el menu principal con todas las opciones disponibles
 static void show_menu() {
     printf("\n--- Menu ---\n");
@@ -18,6 +36,26 @@ static void show_menu() {
     printf("4) Mostrar matriz de adyacencia\n");
     printf("5) Generar grafo aleatorio y ejecutar BFS\n");
     printf("6) Generar grafo aleatorio y ejecutar Dijkstra\n");
+    printf("7) Ejecutar BFS sobre la cuadricula (sin construir grafo)\n");
+    printf("8) Ejecutar Dijkstra sobre la cuadricula (sin construir grafo)\n");
+    printf("9) Guardar laberinto actual (texto o binario)\n");
+    printf("10) Ejecutar A* (I -> F)\n");
+    printf("11) Ejecutar BFS bidireccional (I <-> F)\n");
+    printf("12) Ejecutar Dijkstra bidireccional (I <-> F)\n");
+    printf("13) Ejecutar Jump Point Search sobre la cuadricula\n");
+    printf("14) Elegir cola de prioridad para Dijkstra\n");
+    printf("15) Medir colas de prioridad con la traza de Dijkstra sobre el laberinto\n");
+    printf("16) Activar/desactivar el seguimiento paso a paso de Dijkstra\n");
+    printf("17) Resolver un lote de consultas aleatorias con varios hilos\n");
+    printf("18) Preprocesar landmarks (ALT) para consultas repetidas\n");
+    printf("19) Ejecutar A* con landmarks (I -> F)\n");
+    printf("20) Preprocesar jerarquia de contraccion (CH)\n");
+    printf("21) Consultar camino con la jerarquia de contraccion (I -> F)\n");
+    printf("22) Abrir/cerrar celdas y replanificar el camino (LPA*)\n");
+    printf("23) Ejecutar BFS paralelo por niveles (I -> F)\n");
+    printf("24) Distancias desde I con delta-stepping en paralelo\n");
+    printf("25) Generar laberinto (backtracker, Kruskal o Wilson)\n");
+    printf("26) Exportar grafo completo (lista de aristas, Matrix Market o DIMACS)\n");
     printf("0) Salir\n");
     printf("> ");
 }
@@ -36,15 +74,35 @@ int main() {
     //flags para controlar el estado del programa
     int mazeLoaded = 0;  //indica si hay un laberinto cargado
     int graphReady = 0;  //indica si el grafo esta listo para usar
+    int mazeFromFile = 0; //indica si las celdas vienen de un archivo (busqueda en cuadricula)
     
+    //cola de prioridad usada por Dijkstra (opciones 3, 6 y 8) y seguimiento paso a paso
+    //(el seguimiento imprime todos los nodos en cada paso y anula el atajo BFS de pesos unitarios,
+    //por eso empieza apagado; se activa con la opcion 16)
+    struct OpcionesDijkstra opcionesDijkstra = {COLA_HEAP_BINARIO, NULL, {NULL, NULL}};
+
+    //arreglos de busqueda reutilizados entre consultas (se recrean solo si el grafo crece);
+    //las busquedas sobre la cuadricula (7, 8 y 13) lo usan indexado por celda
+    struct EspacioBusqueda* espacio = NULL;
+
+    //landmarks precalculados para el grafo actual (NULL hasta usar la opcion 18)
+    struct OraculoALT* oraculo = NULL;
+
+    //jerarquia de contraccion del grafo actual (NULL hasta usar la opcion 20) y segundo
+    //espacio de busqueda para el lado de la meta en las consultas bidireccionales (11, 12 y 21)
+    struct JerarquiaContraccion* jerarquia = NULL;
+    struct EspacioBusqueda* espacioVuelta = NULL;
+
     //buffer para leer entrada del usuario
     char input[256];
 
-    //inicializar el generador de numeros aleatorios
-    srand((unsigned)time(NULL));
+    //inicializar el generador de numeros aleatorios (las opciones 5 y 6 lo vuelven a sembrar)
+    sembrarAleatorioHilo(semillaDeReloj());
 
     printf("Proyecto Laberinto + Grafo\n");
     printf("Formato de archivo: mismo numero de columnas por fila. Usa 'X' para muro, '.' o espacio para camino, 'I' inicio, 'F' meta.\n");
+    printf("Las celdas '1'..'9' son terreno transitable: entrar en ellas cuesta su valor.\n");
+    printf("Tambien se aceptan laberintos binarios (1 bit por celda) guardados con la opcion 9.\n");
 
     for (;;) {
         show_menu();
@@ -66,27 +124,34 @@ int main() {
             trim_newline(input);
             
             //cargar el laberinto desde el archivo
+            mazeFromFile = 0;
             if (load_maze(input, &maze) == 0) {
+                //las busquedas sobre la cuadricula solo necesitan las celdas
+                mazeFromFile = 1;
+
                 //convertir el laberinto en un grafo
                 //cada celda transitable se convierte en un nodo
                 //las celdas adyacentes se conectan con aristas
+                //el grafo cambia: el oraculo ALT y la jerarquia anteriores ya no sirven
+                liberarOraculoALT(oraculo);
+                oraculo = NULL;
+                liberarJerarquia(jerarquia);
+                jerarquia = NULL;
                 if (build_graph(&maze, &graph, &startIndex, &goalIndex) == 0) {
-                    //verificar que exista al menos un camino entre inicio y meta
-                    int *parent = calloc(graph.vertices, sizeof(int));
-                    int *visitOrder = calloc(graph.vertices, sizeof(int));
-                    int visitCount = 0;
-                    if (parent == NULL || visitOrder == NULL) {
-                        printf("No se pudo reservar memoria para validar el laberinto.\n");
-                        free(parent);
-                        free(visitOrder);
-                        liberarGrafo(&graph);
-                        mazeLoaded = 0;
-                        graphReady = 0;
-                        continue;
+                    //verificar que exista al menos un camino entre inicio y meta:
+                    //build_graph ya etiqueto las componentes, basta comparar dos etiquetas
+                    int found = mismaComponente(&graph, startIndex, goalIndex);
+                    if (found == -1) {
+                        //sin etiquetas (falto memoria al construir) se valida con BFS
+                        if (prepararEspacioBusqueda(&espacio, graph.vertices) != 0) {
+                            printf("No se pudo reservar memoria para validar el laberinto.\n");
+                            liberarGrafo(&graph);
+                            mazeLoaded = 0;
+                            graphReady = 0;
+                            continue;
+                        }
+                        found = bfs_espacio(&graph, startIndex, goalIndex, espacio);
                     }
-                    int found = bfs(&graph, startIndex, goalIndex, parent, visitOrder, &visitCount);
-                    free(parent);
-                    free(visitOrder);
                     
                     if (!found) {
                         printf("El laberinto no tiene camino entre I y F. Cargue otro archivo.\n");
@@ -98,7 +163,7 @@ int main() {
 
                     mazeLoaded = 1;
                     graphReady = 1;
-                    printf("Laberinto cargado. Dimensiones: %d x %d. Nodos: %d.\n", maze.rows, maze.cols, graph.vertices);
+                    printf("Laberinto cargado. Dimensiones: %d x %d. Nodos: %d. Componentes: %d.\n", maze.rows, maze.cols, graph.vertices, graph.componentes);
                     printf("Inicio (I): indice %d, Meta (F): indice %d.\n", startIndex, goalIndex);
                 } else {
                     mazeLoaded = 0;
@@ -112,30 +177,24 @@ int main() {
                 continue;
             }
             
-            //reservar memoria para los arreglos auxiliares de BFS
-            int *parent = calloc(graph.vertices, sizeof(int));       //para reconstruir el camino
-            int *visitOrder = calloc(graph.vertices, sizeof(int));   //orden de exploracion
-            int visitCount = 0;
-            int *pathSeq = calloc(graph.vertices, sizeof(int));      //secuencia start->goal para mostrar
-            
-            if (parent == NULL || visitOrder == NULL || pathSeq == NULL) {
+            //los arreglos auxiliares de BFS (padres, orden de exploracion y secuencia
+            //start->goal) viven en el espacio de busqueda y se reutilizan entre consultas
+            if (prepararEspacioBusqueda(&espacio, graph.vertices) != 0) {
                 printf("No se pudo reservar memoria para BFS.\n");
-                free(parent);
-                free(visitOrder);
-                free(pathSeq);
                 continue;
             }
+            int *parent = espacio->parent;
             
             //ejecutar el algoritmo BFS
-            int found = bfs(&graph, startIndex, goalIndex, parent, visitOrder, &visitCount);
+            int found = bfs_espacio(&graph, startIndex, goalIndex, espacio);
             
             //mostrar el orden en que se visitaron los nodos
-            print_visit_order(&graph, visitOrder, visitCount);
+            print_visit_order(&graph, espacio->orden, espacio->cantidadOrden);
             
             int len = -1;
             if (found) {
                 //reconstruir secuencia del camino para visualizarlo
-                len = build_path_sequence(parent, startIndex, goalIndex, graph.vertices, pathSeq);
+                len = build_path_sequence(parent, startIndex, goalIndex, graph.vertices, espacio->camino);
                 if (len > 0) {
                     //mostrar el camino encontrado en el laberinto
                     print_path_steps(&maze, &graph, parent, startIndex, goalIndex);
@@ -146,10 +205,6 @@ int main() {
             } else {
                 printf("No hay camino entre I y F.\n");
             }
-            
-            free(parent);
-            free(visitOrder);
-            free(pathSeq);
         } else if (option == 3) {
             // Ejecutar Dijkstra en el laberinto cargado
             if (!mazeLoaded) {
@@ -157,33 +212,23 @@ int main() {
                 continue;
             }
             
+            if (prepararEspacioBusqueda(&espacio, graph.vertices) != 0) {
+                printf("No se pudo reservar memoria para Dijkstra.\n");
+                continue;
+            }
+
             //ejecutar el algoritmo de Dijkstra para encontrar el camino optimo
-            struct Camino* camino = dijkstra(&graph, startIndex, goalIndex);
+            struct Camino* camino = dijkstraConEspacio(&graph, startIndex, goalIndex, &opcionesDijkstra, espacio);
             
             if (camino != NULL) {
                 printf("Dijkstra encontro un camino:\n");
                 //imprimir el camino con su valor total
                 imprimirCaminoDijkstra(camino);
                 
-                //reconstruir arreglo parent para visualizacion en el laberinto
-                //el algoritmo Dijkstra retorna una estructura Camino, pero la funcion
-                //de visualizacion necesita un arreglo parent (como el que usa BFS)
-                int* parent = calloc(graph.vertices, sizeof(int));
-                if (parent != NULL) {
-                    //inicializar todos los padres en -1
-                    for (int i = 0; i < graph.vertices; ++i) {
-                        parent[i] = -1;
-                    }
-                    //reconstruir el arreglo parent desde el camino encontrado
-                    //para cada nodo en el camino, su padre es el nodo anterior
-                    for (int i = 1; i < camino->longitud; ++i) {
-                        parent[camino->nodos[i]] = camino->nodos[i - 1];
-                    }
-                    //mostrar el camino en el laberinto
-                    print_path_steps(&maze, &graph, parent, startIndex, goalIndex);
-                    print_path_on_maze(&maze, &graph, parent, startIndex, goalIndex);
-                    free(parent);
-                }
+                //la funcion de visualizacion necesita un arreglo parent (como el que usa BFS);
+                //el espacio conserva el arbol de Dijkstra, cuya cadena desde la meta es el camino
+                print_path_steps(&maze, &graph, espacio->parent, startIndex, goalIndex);
+                print_path_on_maze(&maze, &graph, espacio->parent, startIndex, goalIndex);
                 
                 liberarCamino(camino);
             } else {
@@ -198,16 +243,19 @@ int main() {
             //imprimir la matriz que muestra las conexiones entre nodos
             //un valor > 0 indica que hay una arista entre dos nodos
             print_adjacency_matrix(&graph);
+            if (graph.vertices > 30) {
+                printf("Use la opcion 26 para exportar el grafo completo.\n");
+            }
         } else if (option == 5) {
             //OPCION 5: Generar grafo aleatorio y ejecutar BFS
-            printf("Numero de nodos (2-100): ");
+            printf("Numero de nodos (2-%d): ", MAX_VERTICES_ALEATORIO);
             if (fgets(input, sizeof(input), stdin) == NULL) {
                 break;
             }
             //leer el numero de nodos para el grafo
             int vertices = atoi(input);
-            if (vertices < 2 || vertices > 100) {
-                printf("Valor fuera de rango. Debe ser entre 2 y 100.\n");
+            if (vertices < 2 || vertices > MAX_VERTICES_ALEATORIO) {
+                printf("Valor fuera de rango. Debe ser entre 2 y %d.\n", MAX_VERTICES_ALEATORIO);
                 continue;
             }
             //leer la probabilidad de arista entre nodos
@@ -223,17 +271,32 @@ int main() {
             }
             double edgeProb = probPct / 100.0;
 
+            //la misma semilla repite el mismo grafo y los mismos I/F
+            printf("Semilla (vacio = reloj): ");
+            if (fgets(input, sizeof(input), stdin) == NULL) {
+                break;
+            }
+            trim_newline(input);
+            uint64_t semilla = (input[0] != '\0') ? strtoull(input, NULL, 10) : semillaDeReloj();
+            sembrarAleatorioHilo(semilla);
+            printf("Semilla: %llu\n", (unsigned long long)semilla);
+
             //generar un grafo aleatorio con el numero de nodos y probabilidad especificados
+            liberarOraculoALT(oraculo); //el oraculo ALT y la jerarquia eran del grafo anterior
+            oraculo = NULL;
+            liberarJerarquia(jerarquia);
+            jerarquia = NULL;
             if (generate_random_graph(&graph, vertices, edgeProb) == 0) {
                 graphReady = 1;
 
                 //seleccionar nodos de inicio y meta aleatorios
-                startIndex = rand() % vertices;
+                startIndex = (int)aleatorioRango(aleatorioHilo(), (uint32_t)vertices);
                 do {
-                    goalIndex = rand() % vertices;
+                    goalIndex = (int)aleatorioRango(aleatorioHilo(), (uint32_t)vertices);
                 } while (goalIndex == startIndex && vertices > 1);
 
                 //construir representacion visual del laberinto a partir del grafo
+                mazeFromFile = 0; //el laberinto visual se reemplaza por el del grafo
                 if (build_maze_from_graph(&graph, &maze, startIndex, goalIndex) == 0) {
                     mazeLoaded = 1;
                     printf("Laberinto generado. Dimensiones: %d x %d. Nodos: %d.\n", maze.rows, maze.cols, graph.vertices);
@@ -244,45 +307,40 @@ int main() {
                     continue;
                 }
 
-                //reservar memoria para BFS
-                int *parent = calloc(graph.vertices, sizeof(int));
-                int *visitOrder = calloc(graph.vertices, sizeof(int));
-                int visitCount = 0;
-
-                if (parent == NULL || visitOrder == NULL) {
+                //preparar los arreglos de BFS (se reutilizan si el espacio ya alcanza)
+                if (prepararEspacioBusqueda(&espacio, graph.vertices) != 0) {
                     printf("No se pudo reservar memoria para BFS.\n");
-                    free(parent);
-                    free(visitOrder);
                     continue;
                 }
+                int *parent = espacio->parent;
 
                 //ejecutar BFS en el grafo aleatorio
-                int found = bfs(&graph, startIndex, goalIndex, parent, visitOrder, &visitCount);
+                int found = bfs_espacio(&graph, startIndex, goalIndex, espacio);
 
                 //mostrar resultados
                 print_adjacency_matrix(&graph); //mostrar la matriz de adyacencia
                 printf("BFS desde nodo %d hasta nodo %d\n", startIndex, goalIndex);
 
-                if (found) {
+                if (found && graph.vertices > MAX_NODOS_DIBUJO) {
+                    printf("Hay camino (%d nodos visitados); el grafo es muy grande para dibujarlo.\n", espacio->cantidadOrden);
+                } else if (found) {
                     //mostrar laberinto con animacion paso a paso
                     print_path_steps(&maze, &graph, parent, startIndex, goalIndex);
                     print_path_on_maze(&maze, &graph, parent, startIndex, goalIndex);
                 } else {
                     printf("No hay camino entre %d y %d.\n", startIndex, goalIndex);
                 }
-                free(parent);
-                free(visitOrder);
             }
         } else if (option == 6) {
             // Generar grafo aleatorio y ejecutar Dijkstra
-            printf("Numero de nodos (2-100): ");
+            printf("Numero de nodos (2-%d): ", MAX_VERTICES_ALEATORIO);
             if (fgets(input, sizeof(input), stdin) == NULL) {
                 break;
             }
             //leer el numero de nodos para el grafo
             int vertices = atoi(input);
-            if (vertices < 2 || vertices > 100) {
-                printf("Valor fuera de rango. Debe ser entre 2 y 100.\n");
+            if (vertices < 2 || vertices > MAX_VERTICES_ALEATORIO) {
+                printf("Valor fuera de rango. Debe ser entre 2 y %d.\n", MAX_VERTICES_ALEATORIO);
                 continue;
             }
             //leer la probabilidad de arista entre nodos
@@ -298,17 +356,32 @@ int main() {
             }
             double edgeProb = probPct / 100.0;
 
+            //la misma semilla repite el mismo grafo y los mismos I/F
+            printf("Semilla (vacio = reloj): ");
+            if (fgets(input, sizeof(input), stdin) == NULL) {
+                break;
+            }
+            trim_newline(input);
+            uint64_t semilla = (input[0] != '\0') ? strtoull(input, NULL, 10) : semillaDeReloj();
+            sembrarAleatorioHilo(semilla);
+            printf("Semilla: %llu\n", (unsigned long long)semilla);
+
             //generar un grafo aleatorio
+            liberarOraculoALT(oraculo); //el oraculo ALT y la jerarquia eran del grafo anterior
+            oraculo = NULL;
+            liberarJerarquia(jerarquia);
+            jerarquia = NULL;
             if (generate_random_graph(&graph, vertices, edgeProb) == 0) {
                 graphReady = 1;
 
                 //seleccionar nodos de inicio y meta aleatorios
-                startIndex = rand() % vertices;
+                startIndex = (int)aleatorioRango(aleatorioHilo(), (uint32_t)vertices);
                 do {
-                    goalIndex = rand() % vertices;
+                    goalIndex = (int)aleatorioRango(aleatorioHilo(), (uint32_t)vertices);
                 } while (goalIndex == startIndex && vertices > 1);
 
                 //construir representacion visual del laberinto a partir del grafo
+                mazeFromFile = 0; //el laberinto visual se reemplaza por el del grafo
                 if (build_maze_from_graph(&graph, &maze, startIndex, goalIndex) == 0) {
                     mazeLoaded = 1;
                     printf("Laberinto generado. Dimensiones: %d x %d. Nodos: %d.\n", maze.rows, maze.cols, graph.vertices);
@@ -323,28 +396,22 @@ int main() {
                 print_adjacency_matrix(&graph);
                 printf("Dijkstra desde nodo %d hasta nodo %d\n", startIndex, goalIndex);
 
+                if (prepararEspacioBusqueda(&espacio, graph.vertices) != 0) {
+                    printf("No se pudo reservar memoria para Dijkstra.\n");
+                    continue;
+                }
+
                 //ejecutar el algoritmo de Dijkstra
-                struct Camino* camino = dijkstra(&graph, startIndex, goalIndex);
+                struct Camino* camino = dijkstraConEspacio(&graph, startIndex, goalIndex, &opcionesDijkstra, espacio);
                 if (camino != NULL) {
                     printf("Camino encontrado:\n");
                     //mostrar el camino y su valor total
                     imprimirCaminoDijkstra(camino);
 
-                    //reconstruir arreglo parent para visualizacion
-                    int* parent = calloc(graph.vertices, sizeof(int));
-                    if (parent != NULL) {
-                        //inicializar todos los padres en -1
-                        for (int i = 0; i < graph.vertices; ++i) {
-                            parent[i] = -1;
-                        }
-                        //reconstruir el arreglo parent desde el camino encontrado
-                        for (int i = 1; i < camino->longitud; ++i) {
-                            parent[camino->nodos[i]] = camino->nodos[i - 1];
-                        }
-                        //mostrar laberinto con animacion paso a paso
-                        print_path_steps(&maze, &graph, parent, startIndex, goalIndex);
-                        print_path_on_maze(&maze, &graph, parent, startIndex, goalIndex);
-                        free(parent);
+                    //mostrar laberinto con animacion paso a paso (el espacio conserva los padres)
+                    if (graph.vertices <= MAX_NODOS_DIBUJO) {
+                        print_path_steps(&maze, &graph, espacio->parent, startIndex, goalIndex);
+                        print_path_on_maze(&maze, &graph, espacio->parent, startIndex, goalIndex);
                     }
 
                     liberarCamino(camino);
@@ -352,13 +419,722 @@ int main() {
                     printf("No hay camino entre %d y %d.\n", startIndex, goalIndex);
                 }
             }
+        } else if (option == 7) {
+            //Ejecutar BFS directamente sobre las celdas del laberinto cargado
+            if (!mazeFromFile) {
+                printf("Primero cargue un laberinto desde archivo.\n");
+                continue;
+            }
+
+            //ubicar I y F en la cuadricula
+            int startCell = -1;
+            int goalCell = -1;
+            if (grid_find_endpoints(&maze, &startCell, &goalCell) != 0) {
+                continue;
+            }
+
+            //el espacio se indexa por celda, no por vertice; se reutiliza entre consultas
+            int cells = maze.rows * maze.cols;
+            if (prepararEspacioBusqueda(&espacio, cells) != 0) {
+                printf("No se pudo reservar memoria para BFS.\n");
+                continue;
+            }
+
+            int found = bfs_grid_espacio(&maze, startCell, goalCell, espacio);
+            printf("BFS sobre la cuadricula: %d celdas visitadas.\n", espacio->cantidadOrden);
+
+            if (found) {
+                int len = build_path_sequence(espacio->parent, startCell, goalCell, cells, espacio->camino);
+                printf("Camino de %d celdas.\n", len);
+                print_cell_path_on_maze(&maze, espacio->camino, len);
+            } else {
+                printf("No hay camino entre I y F.\n");
+            }
+        } else if (option == 8) {
+            //Ejecutar Dijkstra directamente sobre las celdas del laberinto cargado
+            if (!mazeFromFile) {
+                printf("Primero cargue un laberinto desde archivo.\n");
+                continue;
+            }
+
+            int startCell = -1;
+            int goalCell = -1;
+            if (grid_find_endpoints(&maze, &startCell, &goalCell) != 0) {
+                continue;
+            }
+
+            if (prepararEspacioBusqueda(&espacio, maze.rows * maze.cols) != 0) {
+                printf("No se pudo reservar memoria para la busqueda.\n");
+                continue;
+            }
+
+            //el camino retornado contiene indices de celda
+            struct Camino* camino = dijkstra_grid_con_espacio(&maze, startCell, goalCell, &opcionesDijkstra, espacio);
+            if (camino != NULL) {
+                printf("Dijkstra sobre la cuadricula encontro un camino de %d celdas (valor %d).\n", camino->longitud, camino->valorTotal);
+                print_cell_path_on_maze(&maze, camino->nodos, camino->longitud);
+                liberarCamino(camino);
+            } else {
+                printf("No hay camino entre I y F.\n");
+            }
+        } else if (option == 9) {
+            //Guardar el laberinto actual; sirve para convertir entre texto y binario
+            if (!mazeLoaded) {
+                printf("Primero cargue un laberinto valido o genere un grafo aleatorio.\n");
+                continue;
+            }
+            printf("Formato (t = texto, b = binario): ");
+            if (fgets(input, sizeof(input), stdin) == NULL) {
+                break;
+            }
+            int binary = (input[0] == 'b' || input[0] == 'B');
+            printf("Ruta de salida: ");
+            if (fgets(input, sizeof(input), stdin) == NULL) {
+                break;
+            }
+            trim_newline(input);
+
+            int saved = binary ? save_maze_binary(input, &maze) : save_maze_text(input, &maze);
+            if (saved == 0) {
+                printf("Laberinto guardado en formato %s.\n", binary ? "binario" : "texto");
+            }
+        } else if (option == 10) {
+            //Ejecutar A* en el grafo actual (laberinto cargado o generado)
+            if (!mazeLoaded) {
+                printf("Primero cargue un laberinto valido.\n");
+                continue;
+            }
+
+            if (prepararEspacioBusqueda(&espacio, graph.vertices) != 0) {
+                printf("No se pudo reservar memoria para la busqueda.\n");
+                continue;
+            }
+
+            struct Camino* camino = astar(&graph, startIndex, goalIndex, espacio);
+            if (camino != NULL) {
+                printf("A* encontro un camino:\n");
+                imprimirCaminoDijkstra(camino);
+                printf("Vertices expandidos: %d de %d.\n", camino->expandidos, graph.vertices);
+
+                //el arbol de la consulta queda en el espacio, no hace falta reconstruir parent
+                print_path_on_maze(&maze, &graph, espacio->parent, startIndex, goalIndex);
+                liberarCamino(camino);
+            } else {
+                printf("No hay camino entre I y F.\n");
+            }
+        } else if (option == 11) {
+            //Ejecutar BFS desde I y desde F a la vez
+            if (!mazeLoaded) {
+                printf("Primero cargue un laberinto valido.\n");
+                continue;
+            }
+
+            //un espacio por frente; ambos se reutilizan entre consultas
+            if (prepararEspacioBusqueda(&espacio, graph.vertices) != 0
+                || prepararEspacioBusqueda(&espacioVuelta, graph.vertices) != 0) {
+                printf("No se pudo reservar memoria para BFS.\n");
+                continue;
+            }
+
+            int found = bfs_bidireccional(&graph, startIndex, goalIndex, espacio, espacioVuelta);
+            int visitCount = espacio->cantidadOrden + espacioVuelta->cantidadOrden;
+            printf("BFS bidireccional: %d nodos visitados de %d.\n", visitCount, graph.vertices);
+            if (found) {
+                print_path_on_maze(&maze, &graph, espacio->parent, startIndex, goalIndex);
+            } else {
+                printf("No hay camino entre I y F.\n");
+            }
+        } else if (option == 12) {
+            //Ejecutar Dijkstra desde I y desde F a la vez
+            if (!mazeLoaded) {
+                printf("Primero cargue un laberinto valido.\n");
+                continue;
+            }
+
+            if (prepararEspacioBusqueda(&espacio, graph.vertices) != 0
+                || prepararEspacioBusqueda(&espacioVuelta, graph.vertices) != 0) {
+                printf("No se pudo reservar memoria para la busqueda.\n");
+                continue;
+            }
+
+            struct Camino* camino = dijkstraBidireccional(&graph, startIndex, goalIndex, espacio, espacioVuelta);
+            if (camino != NULL) {
+                printf("Dijkstra bidireccional encontro un camino:\n");
+                imprimirCaminoDijkstra(camino);
+                printf("Vertices expandidos: %d de %d.\n", camino->expandidos, graph.vertices);
+
+                //el espacio del frente de inicio ya tiene la cadena F -> I unida
+                print_path_on_maze(&maze, &graph, espacio->parent, startIndex, goalIndex);
+                liberarCamino(camino);
+            } else {
+                printf("No hay camino entre I y F.\n");
+            }
+        } else if (option == 13) {
+            //Ejecutar JPS directamente sobre las celdas del laberinto cargado
+            if (!mazeFromFile) {
+                printf("Primero cargue un laberinto desde archivo.\n");
+                continue;
+            }
+
+            int startCell = -1;
+            int goalCell = -1;
+            if (grid_find_endpoints(&maze, &startCell, &goalCell) != 0) {
+                continue;
+            }
+
+            if (!grid_uniform_cost(&maze)) {
+                printf("JPS solo aplica a laberintos de costo uniforme; use Dijkstra (opcion 8) con celdas de terreno.\n");
+                continue;
+            }
+
+            if (prepararEspacioBusqueda(&espacio, maze.rows * maze.cols) != 0) {
+                printf("No se pudo reservar memoria para la busqueda.\n");
+                continue;
+            }
+
+            //el camino ya viene expandido a todas las celdas del recorrido
+            struct Camino* camino = jps_grid_espacio(&maze, startCell, goalCell, espacio);
+            if (camino != NULL) {
+                printf("JPS encontro un camino de %d celdas (valor %d), %d puntos de salto expandidos.\n", camino->longitud, camino->valorTotal, camino->expandidos);
+                print_cell_path_on_maze(&maze, camino->nodos, camino->longitud);
+                liberarCamino(camino);
+            } else {
+                printf("No hay camino entre I y F.\n");
+            }
+        } else if (option == 14) {
+            //Elegir la implementacion de la cola de prioridad en tiempo de ejecucion
+            printf("Cola actual: %s\n", nombreTipoCola(opcionesDijkstra.tipoCola));
+            for (int t = 0; t < NUM_TIPOS_COLA; ++t) {
+                printf("%d) %s\n", t + 1, nombreTipoCola((enum TipoCola)t));
+            }
+            printf("> ");
+            if (fgets(input, sizeof(input), stdin) == NULL) {
+                break;
+            }
+            int tipo = atoi(input);
+            if (tipo < 1 || tipo > NUM_TIPOS_COLA) {
+                printf("Opcion no valida.\n");
+                continue;
+            }
+            opcionesDijkstra.tipoCola = (enum TipoCola)(tipo - 1);
+            printf("Dijkstra usara: %s\n", nombreTipoCola(opcionesDijkstra.tipoCola));
+        } else if (option == 15) {
+            //Grabar las operaciones de cola de un Dijkstra real y reproducirlas con cada implementacion
+            if (!mazeFromFile) {
+                printf("Primero cargue un laberinto desde archivo.\n");
+                continue;
+            }
+
+            int startCell = -1;
+            int goalCell = -1;
+            if (grid_find_endpoints(&maze, &startCell, &goalCell) != 0) {
+                continue;
+            }
+
+            struct TrazaCola* traza = crearTrazaCola();
+            if (traza == NULL) {
+                printf("Error al reservar memoria para la traza.\n");
+                continue;
+            }
+            struct OpcionesDijkstra opcionesTraza = {COLA_HEAP_BINARIO, traza, {NULL, NULL}};
+            liberarCamino(dijkstra_grid_con_opciones(&maze, startCell, goalCell, &opcionesTraza));
+
+            //repetir trazas cortas para que el tiempo medido no sea solo ruido del reloj
+            int repeticiones = (traza->cantidad > 0) ? 2000000 / traza->cantidad : 1;
+            if (repeticiones < 1) {
+                repeticiones = 1;
+            }
+            enum TipoCola mejor = compararColas(traza, repeticiones);
+            printf("La mas rapida para este laberinto: %s (elijala con la opcion 14)\n", nombreTipoCola(mejor));
+            liberarTrazaCola(traza);
+        } else if (option == 16) {
+            //Alternar el observador que imprime el estado de Dijkstra en cada paso
+            if (opcionesDijkstra.observador.expandido != NULL) {
+                opcionesDijkstra.observador.expandido = NULL;
+                printf("Seguimiento paso a paso de Dijkstra desactivado.\n");
+            } else {
+                opcionesDijkstra.observador.expandido = observar_estado_dijkstra;
+                printf("Seguimiento paso a paso de Dijkstra activado.\n");
+                if (graphReady && graph.vertices > MAX_NODOS_DIBUJO) {
+                    printf("Aviso: el grafo actual tiene %d nodos; cada paso los imprime todos.\n", graph.vertices);
+                }
+            }
+        } else if (option == 17) {
+            //Resolver muchas consultas (inicio, meta) sobre el grafo actual repartidas entre hilos
+            if (!graphReady) {
+                printf("Primero cargue un laberinto o genere un grafo aleatorio.\n");
+                continue;
+            }
+            printf("Cantidad de consultas: ");
+            if (fgets(input, sizeof(input), stdin) == NULL) {
+                break;
+            }
+            int cantidad = atoi(input);
+            if (cantidad <= 0) {
+                printf("La cantidad debe ser mayor a 0.\n");
+                continue;
+            }
+            printf("Hilos (0 = todos los nucleos, %d): ", hilosDisponibles());
+            if (fgets(input, sizeof(input), stdin) == NULL) {
+                break;
+            }
+            int hilos = atoi(input);
+
+            struct ConsultaLote* consultas = malloc((size_t)cantidad * sizeof(struct ConsultaLote));
+            struct ResultadoLote* resultados = malloc((size_t)cantidad * sizeof(struct ResultadoLote));
+            if (consultas == NULL || resultados == NULL) {
+                printf("No se pudo reservar memoria para el lote.\n");
+                free(consultas);
+                free(resultados);
+                continue;
+            }
+            for (int i = 0; i < cantidad; ++i) {
+                consultas[i].inicio = (int)aleatorioRango(aleatorioHilo(), (uint32_t)graph.vertices);
+                consultas[i].fin = (int)aleatorioRango(aleatorioHilo(), (uint32_t)graph.vertices);
+            }
+
+            //medir tiempo de pared (no de CPU, que sumaria el de todos los hilos)
+            struct timespec antes;
+            timespec_get(&antes, TIME_UTC);
+            int estado = resolverLote(&graph, consultas, cantidad, hilos, 0, &opcionesDijkstra, resultados);
+            double segundos = segundosDesde(&antes);
+
+            if (estado != 0) {
+                printf("No se pudo resolver el lote.\n");
+            } else {
+                int sinRuta = 0;
+                for (int i = 0; i < cantidad; ++i) {
+                    if (resultados[i].valor < 0) {
+                        sinRuta++;
+                    }
+                }
+                int mostrar = cantidad < 5 ? cantidad : 5;
+                for (int i = 0; i < mostrar; ++i) {
+                    printf("  %d -> %d: valor %d\n", consultas[i].inicio, consultas[i].fin, resultados[i].valor);
+                }
+                printf("%d consultas (%d sin ruta) en %.3f s: %.0f consultas/s\n", cantidad, sinRuta, segundos,
+                       segundos > 0 ? cantidad / segundos : 0.0);
+            }
+            free(consultas);
+            free(resultados);
+        } else if (option == 18) {
+            //Elegir k landmarks y guardar su distancia a todos los vertices
+            if (!graphReady) {
+                printf("Primero cargue un laberinto o genere un grafo aleatorio.\n");
+                continue;
+            }
+            printf("Cantidad de landmarks (1-64): ");
+            if (fgets(input, sizeof(input), stdin) == NULL) {
+                break;
+            }
+            int k = atoi(input);
+            if (k < 1 || k > 64) {
+                printf("Valor fuera de rango. Debe ser entre 1 y 64.\n");
+                continue;
+            }
+
+            liberarOraculoALT(oraculo);
+            oraculo = crearOraculoALT(&graph, k, startIndex);
+            if (oraculo == NULL) {
+                printf("No se pudo preprocesar los landmarks.\n");
+                continue;
+            }
+            printf("Landmarks: %d, preproceso: %.3f s, memoria: %.1f KB (k x V = %d x %d)\n", oraculo->k,
+                   oraculo->segundosPreproceso, oraculo->bytes / 1024.0, oraculo->k, oraculo->vertices);
+        } else if (option == 19) {
+            //Consultar I -> F con A* guiado por los landmarks
+            if (!mazeLoaded) {
+                printf("Primero cargue un laberinto valido.\n");
+                continue;
+            }
+            if (oraculo == NULL) {
+                printf("Primero preprocese los landmarks con la opcion 18.\n");
+                continue;
+            }
+            if (prepararEspacioBusqueda(&espacio, graph.vertices) != 0) {
+                printf("No se pudo reservar memoria para la busqueda.\n");
+                continue;
+            }
+
+            //las cotas salen de la tabla en O(k), sin buscar
+            int inferior;
+            int superior;
+            int estadoCotas = cotasALT(oraculo, startIndex, goalIndex, &inferior, &superior);
+            if (estadoCotas == 0 && superior == -1) {
+                printf("Cota de la distancia: d(I, F) >= %d (sin cota superior con pesos no simetricos)\n", inferior);
+            } else if (estadoCotas == 0) {
+                printf("Cotas de la distancia: %d <= d(I, F) <= %d\n", inferior, superior);
+            } else if (estadoCotas == -1) {
+                printf("Los landmarks indican que I y F estan en componentes distintas.\n");
+            }
+
+            struct timespec antes;
+            timespec_get(&antes, TIME_UTC);
+            struct Camino* camino = caminoALT(&graph, oraculo, startIndex, goalIndex, espacio);
+            double segundos = segundosDesde(&antes);
+
+            if (camino != NULL) {
+                printf("A* con landmarks encontro un camino de valor %d, %d nodos expandidos, %.3f ms\n",
+                       camino->valorTotal, camino->expandidos, segundos * 1000.0);
+                print_path_on_maze(&maze, &graph, espacio->parent, startIndex, goalIndex);
+                liberarCamino(camino);
+            } else {
+                printf("No hay camino entre I y F.\n");
+            }
+        } else if (option == 20) {
+            //Contraer los vertices y guardar el grafo ascendente con atajos
+            if (!graphReady) {
+                printf("Primero cargue un laberinto o genere un grafo aleatorio.\n");
+                continue;
+            }
+
+            liberarJerarquia(jerarquia);
+            jerarquia = NULL;
+            if (!graph.pesosSimetricos) {
+                printf("La jerarquia necesita pesos simetricos; este laberinto tiene celdas de terreno.\n");
+                continue;
+            }
+            jerarquia = construirJerarquia(&graph);
+            if (jerarquia == NULL) {
+                printf("No se pudo construir la jerarquia de contraccion.\n");
+                continue;
+            }
+            printf("Jerarquia: %d vertices, %d aristas originales, %d atajos, preproceso: %.3f s\n",
+                   jerarquia->vertices, jerarquia->aristasOriginales, jerarquia->atajos, jerarquia->segundosPreproceso);
+        } else if (option == 21) {
+            //Consultar I -> F subiendo por la jerarquia desde ambos extremos
+            if (!mazeLoaded) {
+                printf("Primero cargue un laberinto valido.\n");
+                continue;
+            }
+            if (jerarquia == NULL) {
+                printf("Primero construya la jerarquia con la opcion 20.\n");
+                continue;
+            }
+            if (prepararEspacioBusqueda(&espacio, graph.vertices) != 0
+                || prepararEspacioBusqueda(&espacioVuelta, graph.vertices) != 0) {
+                printf("No se pudo reservar memoria para la busqueda.\n");
+                continue;
+            }
+
+            struct timespec antes;
+            timespec_get(&antes, TIME_UTC);
+            struct Camino* camino = caminoJerarquia(jerarquia, startIndex, goalIndex, espacio, espacioVuelta);
+            double segundos = segundosDesde(&antes);
+
+            if (camino == NULL) {
+                printf("No hay camino entre I y F.\n");
+                continue;
+            }
+            printf("La jerarquia encontro un camino de valor %d, %d nodos expandidos, %.3f ms\n",
+                   camino->valorTotal, camino->expandidos, segundos * 1000.0);
+
+            //los atajos ya vienen desempacados en camino->nodos
+            struct Point* celdas = calloc((size_t)camino->longitud * 2, sizeof(struct Point));
+            if (celdas != NULL) {
+                int cantidadCeldas = expand_path_with_intermediate_cells(&maze, &graph, camino->nodos, camino->longitud, celdas);
+                print_points_on_maze(&maze, celdas, cantidadCeldas);
+                free(celdas);
+            }
+            liberarCamino(camino);
+        } else if (option == 22) {
+            //Cambiar celdas del laberinto y reparar el camino con la busqueda anterior
+            if (!mazeFromFile) {
+                printf("Primero cargue un laberinto desde archivo.\n");
+                continue;
+            }
+
+            int startCell = -1;
+            int goalCell = -1;
+            if (grid_find_endpoints(&maze, &startCell, &goalCell) != 0) {
+                continue;
+            }
+            struct PlanificadorLPA* plan = crearPlanificadorLPA(&maze, startCell, goalCell);
+            if (plan == NULL) {
+                printf("No se pudo reservar memoria para el planificador.\n");
+                continue;
+            }
+
+            //la primera replanificacion es una busqueda completa; las siguientes solo reparan
+            struct Camino* camino = replanificarLPA(plan);
+            if (camino != NULL) {
+                printf("Camino inicial de valor %d, %d celdas expandidas.\n", camino->valorTotal, plan->expandidos);
+            } else {
+                printf("No hay camino entre I y F.\n");
+            }
+
+            int cambios = 0;
+            for (;;) {
+                printf("Celdas a cambiar como 'fila col 0|1' (0 = muro, 1 = camino), varias separadas por ';', vacio para terminar: ");
+                if (fgets(input, sizeof(input), stdin) == NULL) {
+                    break;
+                }
+                trim_newline(input);
+                if (input[0] == '\0') {
+                    break;
+                }
+
+                //cada linea es un paso: se aplican todos sus cambios y se replanifica una vez
+                char* cursor = input;
+                int fila;
+                int col;
+                int abrir;
+                int leidos;
+                while (sscanf(cursor, " %d %d %d%n", &fila, &col, &abrir, &leidos) == 3) {
+                    if (cambiarCeldaLPA(plan, fila, col, abrir) != 0) {
+                        printf("Celda (%d, %d) fuera del laberinto o es I/F; se ignora.\n", fila, col);
+                    } else {
+                        cambios++;
+                    }
+                    cursor += leidos;
+                    while (*cursor == ' ' || *cursor == ';') {
+                        cursor++;
+                    }
+                }
+
+                struct timespec antes;
+                timespec_get(&antes, TIME_UTC);
+                liberarCamino(camino);
+                camino = replanificarLPA(plan);
+                double segundos = segundosDesde(&antes);
+                if (camino != NULL) {
+                    printf("Camino reparado de valor %d, %d celdas expandidas, %.3f ms\n", camino->valorTotal, plan->expandidos, segundos * 1000.0);
+                } else {
+                    printf("No hay camino entre I y F (%d celdas expandidas).\n", plan->expandidos);
+                }
+            }
+
+            if (camino != NULL) {
+                print_cell_path_on_maze(&maze, camino->nodos, camino->longitud);
+            }
+            liberarCamino(camino);
+            liberarPlanificadorLPA(plan);
+
+            //el grafo de adyacencia se reconstruye una sola vez al terminar los cambios
+            if (cambios > 0) {
+                liberarOraculoALT(oraculo);
+                oraculo = NULL;
+                liberarJerarquia(jerarquia);
+                jerarquia = NULL;
+                if (build_graph(&maze, &graph, &startIndex, &goalIndex) == 0) {
+                    mazeLoaded = 1;
+                    graphReady = 1;
+                    printf("Grafo reconstruido con los cambios. Nodos: %d.\n", graph.vertices);
+                } else {
+                    mazeLoaded = 0;
+                    graphReady = 0;
+                }
+            }
+        } else if (option == 23) {
+            //Ejecutar BFS repartiendo cada nivel entre varios hilos
+            if (!mazeLoaded) {
+                printf("Primero cargue un laberinto valido.\n");
+                continue;
+            }
+            printf("Hilos (0 = todos los nucleos, %d): ", hilosDisponibles());
+            if (fgets(input, sizeof(input), stdin) == NULL) {
+                break;
+            }
+            int hilos = atoi(input);
+
+            int* parent = malloc((size_t)graph.vertices * sizeof(int));
+            int* dist = malloc((size_t)graph.vertices * sizeof(int));
+            if (parent == NULL || dist == NULL || prepararEspacioBusqueda(&espacio, graph.vertices) != 0) {
+                printf("No se pudo reservar memoria para BFS.\n");
+                free(parent);
+                free(dist);
+                continue;
+            }
+
+            //comparar contra el BFS secuencial con el mismo tiempo de pared
+            struct timespec antes;
+            timespec_get(&antes, TIME_UTC);
+            bfs_espacio(&graph, startIndex, goalIndex, espacio);
+            double secuencial = segundosDesde(&antes);
+
+            timespec_get(&antes, TIME_UTC);
+            int found = bfs_paralelo(&graph, startIndex, goalIndex, parent, dist, hilos);
+            double paralelo = segundosDesde(&antes);
+
+            if (found) {
+                printf("BFS paralelo: distancia %d, %.3f ms (secuencial: %.3f ms)\n", dist[goalIndex], paralelo * 1000.0, secuencial * 1000.0);
+                print_path_on_maze(&maze, &graph, parent, startIndex, goalIndex);
+            } else {
+                printf("No hay camino entre I y F.\n");
+            }
+            free(parent);
+            free(dist);
+        } else if (option == 24) {
+            //Distancias desde el inicio a todos los vertices, cubeta por cubeta entre varios hilos
+            if (!graphReady) {
+                printf("Primero cargue un laberinto o genere un grafo aleatorio.\n");
+                continue;
+            }
+            printf("Ancho de cubeta (0 = sugerido, %d): ", deltaSugerido(&graph));
+            if (fgets(input, sizeof(input), stdin) == NULL) {
+                break;
+            }
+            int delta = atoi(input);
+            printf("Hilos (0 = todos los nucleos, %d): ", hilosDisponibles());
+            if (fgets(input, sizeof(input), stdin) == NULL) {
+                break;
+            }
+            int hilos = atoi(input);
+
+            int* dist = malloc((size_t)graph.vertices * sizeof(int));
+            int* parent = malloc((size_t)graph.vertices * sizeof(int));
+            int* referencia = malloc((size_t)graph.vertices * sizeof(int));
+            if (dist == NULL || parent == NULL || referencia == NULL || prepararEspacioBusqueda(&espacio, graph.vertices) != 0) {
+                printf("No se pudo reservar memoria para las distancias.\n");
+                free(dist);
+                free(parent);
+                free(referencia);
+                continue;
+            }
+
+            struct timespec antes;
+            timespec_get(&antes, TIME_UTC);
+            int alcanzados = deltaStepping(&graph, startIndex, delta, hilos, dist, parent);
+            double segundos = segundosDesde(&antes);
+
+            //comparar con el Dijkstra secuencial
+            timespec_get(&antes, TIME_UTC);
+            dijkstraDistancias(&graph, startIndex, referencia, espacio);
+            double secuencial = segundosDesde(&antes);
+
+            if (alcanzados < 0) {
+                printf("No se pudo ejecutar delta-stepping.\n");
+            } else {
+                int distintas = 0;
+                for (int i = 0; i < graph.vertices; ++i) {
+                    if (dist[i] != referencia[i]) {
+                        distintas++;
+                    }
+                }
+                printf("Delta-stepping: %d vertices alcanzados en %.3f ms (Dijkstra: %.3f ms), %d distancias distintas\n",
+                       alcanzados, segundos * 1000.0, secuencial * 1000.0, distintas);
+                if (goalIndex >= 0 && goalIndex < graph.vertices) {
+                    printf("Distancia a la meta (%d): %d\n", goalIndex, dist[goalIndex]);
+                }
+                if (mazeLoaded && dist[goalIndex] >= 0) {
+                    print_path_on_maze(&maze, &graph, parent, startIndex, goalIndex);
+                }
+            }
+            free(dist);
+            free(parent);
+            free(referencia);
+        } else if (option == 25) {
+            //Generar un laberinto con celdas y tratarlo como uno cargado desde archivo
+            for (int a = 0; a < NUM_ALGORITMOS_LABERINTO; ++a) {
+                printf("%d) %s\n", a + 1, nombreAlgoritmoLaberinto((enum AlgoritmoLaberinto)a));
+            }
+            printf("Algoritmo: ");
+            if (fgets(input, sizeof(input), stdin) == NULL) {
+                break;
+            }
+            int algoritmo = atoi(input);
+            if (algoritmo < 1 || algoritmo > NUM_ALGORITMOS_LABERINTO) {
+                printf("Opcion no valida.\n");
+                continue;
+            }
+            printf("Filas y columnas de celdas (por ejemplo 1001 1001): ");
+            if (fgets(input, sizeof(input), stdin) == NULL) {
+                break;
+            }
+            int filas = 0;
+            int columnas = 0;
+            if (sscanf(input, "%d %d", &filas, &columnas) != 2 || filas < 3 || columnas < 3 || filas + columnas < 8 ||
+                (long long)filas * columnas > INT_MAX) {
+                printf("Dimensiones no validas: al menos 3 x 5 y filas * columnas dentro de int.\n");
+                continue;
+            }
+            printf("Trenzado (0-100%% de callejones que se abren): ");
+            if (fgets(input, sizeof(input), stdin) == NULL) {
+                break;
+            }
+            double trenzadoPct = atof(input);
+            if (trenzadoPct < 0.0 || trenzadoPct > 100.0) {
+                printf("Trenzado fuera de rango. Debe ser 0 a 100.\n");
+                continue;
+            }
+            printf("Semilla (vacio = reloj): ");
+            if (fgets(input, sizeof(input), stdin) == NULL) {
+                break;
+            }
+            trim_newline(input);
+            uint64_t semilla = (input[0] != '\0') ? strtoull(input, NULL, 10) : semillaDeReloj();
+
+            struct timespec antes;
+            timespec_get(&antes, TIME_UTC);
+            int generado = generarLaberinto(&maze, filas, columnas, (enum AlgoritmoLaberinto)(algoritmo - 1), trenzadoPct / 100.0, semilla);
+            double segundos = segundosDesde(&antes);
+
+            //el laberinto anterior ya se reemplazo: el grafo, el oraculo y la jerarquia no sirven
+            liberarOraculoALT(oraculo);
+            oraculo = NULL;
+            liberarJerarquia(jerarquia);
+            jerarquia = NULL;
+            mazeLoaded = 0;
+            graphReady = 0;
+            mazeFromFile = 0;
+            if (generado != 0) {
+                printf("No se pudo generar el laberinto.\n");
+                continue;
+            }
+            mazeFromFile = 1;
+            printf("Laberinto generado con %s en %.3f s (semilla %llu).\n",
+                   nombreAlgoritmoLaberinto((enum AlgoritmoLaberinto)(algoritmo - 1)), segundos, (unsigned long long)semilla);
+
+            //un laberinto generado siempre conecta I y F; no hace falta validarlo con BFS
+            if (build_graph(&maze, &graph, &startIndex, &goalIndex) == 0) {
+                mazeLoaded = 1;
+                graphReady = 1;
+                printf("Dimensiones: %d x %d. Nodos: %d.\n", maze.rows, maze.cols, graph.vertices);
+                printf("Inicio (I): indice %d, Meta (F): indice %d.\n", startIndex, goalIndex);
+            }
+        } else if (option == 26) {
+            //Escribir todas las aristas en un formato disperso para otras herramientas
+            if (!graphReady) {
+                printf("Primero cargue un laberinto valido o genere un grafo aleatorio.\n");
+                continue;
+            }
+            for (int f = 0; f < NUM_FORMATOS_EXPORTACION; ++f) {
+                printf("%d) %s\n", f + 1, nombreFormatoExportacion((enum FormatoExportacion)f));
+            }
+            printf("Formato: ");
+            if (fgets(input, sizeof(input), stdin) == NULL) {
+                break;
+            }
+            int formato = atoi(input);
+            if (formato < 1 || formato > NUM_FORMATOS_EXPORTACION) {
+                printf("Opcion no valida.\n");
+                continue;
+            }
+            printf("Ruta de salida (- = pantalla): ");
+            if (fgets(input, sizeof(input), stdin) == NULL) {
+                break;
+            }
+            trim_newline(input);
+
+            struct timespec antes;
+            timespec_get(&antes, TIME_UTC);
+            int exportado = exportarGrafo(&graph, input, (enum FormatoExportacion)(formato - 1));
+            double segundos = segundosDesde(&antes);
+            if (exportado == 0) {
+                printf("Grafo exportado en formato %s en %.3f s.\n", nombreFormatoExportacion((enum FormatoExportacion)(formato - 1)), segundos);
+            }
         } else {
             printf("Opcion no valida.\n");
         }
     }
 
-    //liberar toda la memoria del grafo antes de salir
+    //liberar toda la memoria del grafo y del laberinto antes de salir
     liberarGrafo(&graph);
+    liberarEspacioBusqueda(espacio);
+    liberarEspacioBusqueda(espacioVuelta);
+    liberarOraculoALT(oraculo);
+    liberarJerarquia(jerarquia);
+    free_maze(&maze);
     printf("Saliendo...\n");
     return 0;
 }
@@ -0,0 +1,85 @@
+#include <stdio.h>
+#include <time.h>
+
+#include "medicion_colas.h"
+#include "reloj.h"
+
+/*
+E: traza con operaciones, tipo de cola y numero de repeticiones.
+S: retorna los nanosegundos promedio por operacion, o -1 si la traza esta vacia o falla la memoria.
+R: la traza debe venir de una cola con capacidad traza->vertices.
+*/
+double reproducirTraza(const struct TrazaCola* traza, enum TipoCola tipo, int repeticiones) {
+    if (traza == NULL || traza->cantidad == 0 || traza->vertices <= 0 || repeticiones <= 0) {
+        return -1.0;
+    }
+    int rango = (traza->rango > 0) ? traza->rango : 1;
+
+    //la cola se crea una sola vez fuera del reloj: crearla cuesta O(capacidad) y
+    //dominaria el tiempo de trazas cortas; entre repeticiones basta vaciarla (O(pendientes))
+    struct ColaPrioridad* cola = crearColaPrioridadTipo(traza->vertices, tipo, rango);
+    if (cola == NULL) {
+        return -1.0;
+    }
+
+    //la suma de los vertices extraidos evita que el compilador descarte el trabajo
+    volatile long suma = 0;
+    struct timespec inicio;
+    timespec_get(&inicio, TIME_UTC);
+    for (int r = 0; r < repeticiones; ++r) {
+        for (int i = 0; i < traza->cantidad; ++i) {
+            const struct OperacionCola* op = &traza->operaciones[i];
+            if (op->tipo == 'I') {
+                insertarCola(cola, op->vertice, op->valor);
+            } else {
+                //con empates cada cola puede extraer un vertice distinto; la carga es la misma
+                suma += extraerMinimo(cola).vertice;
+            }
+        }
+        vaciarColaPrioridad(cola);
+    }
+    double segundos = segundosDesde(&inicio);
+    liberarColaPrioridad(cola);
+
+    return segundos * 1e9 / ((double)traza->cantidad * repeticiones);
+}
+
+/*
+E: traza con operaciones y numero de repeticiones por cola.
+S: imprime una tabla con el tiempo de cada implementacion y retorna la mas rapida.
+R: traza no vacia; si nada se pudo medir retorna COLA_HEAP_BINARIO.
+*/
+enum TipoCola compararColas(const struct TrazaCola* traza, int repeticiones) {
+    enum TipoCola mejor = COLA_HEAP_BINARIO;
+    double mejorTiempo = -1.0;
+
+    if (traza == NULL || traza->cantidad == 0) {
+        printf("La traza esta vacia.\n");
+        return mejor;
+    }
+
+    int inserciones = 0;
+    for (int i = 0; i < traza->cantidad; ++i) {
+        if (traza->operaciones[i].tipo == 'I') {
+            inserciones++;
+        }
+    }
+    printf("Traza: %d operaciones (%d inserciones, %d extracciones), %d vertices, rango %d\n",
+           traza->cantidad, inserciones, traza->cantidad - inserciones, traza->vertices, traza->rango);
+    printf("%-16s %12s\n", "Cola", "ns/operacion");
+
+    for (int t = 0; t < NUM_TIPOS_COLA; ++t) {
+        enum TipoCola tipo = (enum TipoCola)t;
+        double tiempo = reproducirTraza(traza, tipo, repeticiones);
+        if (tiempo < 0) {
+            printf("%-16s %12s\n", nombreTipoCola(tipo), "error");
+            continue;
+        }
+        printf("%-16s %12.2f\n", nombreTipoCola(tipo), tiempo);
+        if (mejorTiempo < 0 || tiempo < mejorTiempo) {
+            mejorTiempo = tiempo;
+            mejor = tipo;
+        }
+    }
+    return mejor;
+}
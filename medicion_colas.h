@@ -0,0 +1,11 @@
+#ifndef MEDICION_COLAS_H
+#define MEDICION_COLAS_H
+
+#include "cola_prioridad.h"
+
+//microbenchmark de colas de prioridad: reproduce una traza grabada de una busqueda real
+//contra cada implementacion y mide el tiempo por operacion
+double reproducirTraza(const struct TrazaCola* traza, enum TipoCola tipo, int repeticiones);
+enum TipoCola compararColas(const struct TrazaCola* traza, int repeticiones);
+
+#endif
@@ -0,0 +1,12 @@
+#include "reloj.h"
+
+/*
+E: instante inicial tomado con timespec_get(antes, TIME_UTC).
+S: retorna los segundos de pared transcurridos desde ese instante.
+R: tiempo de pared, no de CPU (con varios hilos no suma el de cada uno).
+*/
+double segundosDesde(const struct timespec* antes) {
+    struct timespec despues;
+    timespec_get(&despues, TIME_UTC);
+    return (double)(despues.tv_sec - antes->tv_sec) + (double)(despues.tv_nsec - antes->tv_nsec) / 1e9;
+}
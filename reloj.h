@@ -0,0 +1,10 @@
+#ifndef RELOJ_H
+#define RELOJ_H
+
+#include <time.h>
+
+//medicion de tiempo de pared: se toma el instante con timespec_get(&antes, TIME_UTC)
+//y al terminar segundosDesde(&antes) da los segundos transcurridos
+double segundosDesde(const struct timespec* antes);
+
+#endif
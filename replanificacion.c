@@ -0,0 +1,260 @@
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "replanificacion.h"
+#include "cuadricula.h"
+
+//distancia desconocida; deja margen para sumar la heuristica sin desbordar
+#define INF_LPA (INT_MAX / 4)
+
+//la cola solo guarda un entero por celda: la clave es min(g, rhs) + h sin el desempate por
+//min(g, rhs), y se procesan tambien las celdas con clave igual a la de la meta
+//las claves que suben no se actualizan en la cola; se corrigen cuando la celda sale
+
+/*
+E: planificador y celda.
+S: distancia Manhattan de la celda a la meta (heuristica consistente: cada paso cuesta al menos 1).
+R: celda dentro del laberinto.
+*/
+static int heuristicaLPA(const struct PlanificadorLPA* plan, int celda) {
+    int cols = plan->maze->cols;
+    int dr = celda / cols - plan->fin / cols;
+    int dc = celda % cols - plan->fin % cols;
+    return (dr < 0 ? -dr : dr) + (dc < 0 ? -dc : dc);
+}
+
+/*
+E: planificador y celda.
+S: clave de la celda en la cola: min(g, rhs) + h.
+R: celda dentro del laberinto.
+*/
+static int claveLPA(const struct PlanificadorLPA* plan, int celda) {
+    int minimo = plan->g[celda] < plan->rhs[celda] ? plan->g[celda] : plan->rhs[celda];
+    return minimo >= INF_LPA ? INF_LPA : minimo + heuristicaLPA(plan, celda);
+}
+
+/*
+E: planificador y celda.
+S: costo de entrar en la celda (1 o el digito de terreno), 0 si es muro.
+R: celda dentro del laberinto.
+*/
+static int costoCeldaLPA(const struct PlanificadorLPA* plan, int celda) {
+    return cell_cost(plan->maze->cells[celda / plan->maze->cols][celda % plan->maze->cols]);
+}
+
+/*
+E: planificador y celda.
+S: recalcula rhs de la celda con sus vecinos abiertos y la deja en la cola si quedo inconsistente.
+R: celda dentro del laberinto.
+*/
+static void actualizarCeldaLPA(struct PlanificadorLPA* plan, int celda) {
+    if (celda != plan->inicio) {
+        int mejor = INF_LPA;
+        int costo = costoCeldaLPA(plan, celda);
+        if (costo > 0) {
+            int vecinos[4];
+            int count = grid_neighbors(plan->maze, celda, vecinos);
+            for (int k = 0; k < count; ++k) {
+                if (plan->g[vecinos[k]] < INF_LPA && plan->g[vecinos[k]] + costo < mejor) {
+                    mejor = plan->g[vecinos[k]] + costo;
+                }
+            }
+        }
+        plan->rhs[celda] = mejor;
+    }
+
+    //las celdas consistentes que sigan en la cola se descartan al extraerlas
+    if (plan->g[celda] != plan->rhs[celda]) {
+        insertarCola(plan->cola, celda, claveLPA(plan, celda));
+    }
+}
+
+/*
+E: planificador y celda.
+S: actualiza las celdas vecinas transitables.
+R: celda dentro del laberinto.
+*/
+static void actualizarVecinosLPA(struct PlanificadorLPA* plan, int celda) {
+    int vecinos[4];
+    int count = grid_neighbors(plan->maze, celda, vecinos);
+    for (int k = 0; k < count; ++k) {
+        actualizarCeldaLPA(plan, vecinos[k]);
+    }
+}
+
+/*
+E: laberinto (se modifica con cambiarCeldaLPA), celdas inicio y fin.
+S: puntero a planificador listo para la primera replanificacion, o NULL en error.
+R: celdas transitables dentro del laberinto; memoria para 2 enteros y la cola por celda.
+*/
+struct PlanificadorLPA* crearPlanificadorLPA(struct Maze* maze, int inicio, int fin) {
+    if (maze == NULL || maze->rows <= 0 || maze->cols <= 0) {
+        return NULL;
+    }
+    int n = maze->rows * maze->cols;
+    if (inicio < 0 || fin < 0 || inicio >= n || fin >= n) {
+        return NULL;
+    }
+
+    struct PlanificadorLPA* plan = calloc(1, sizeof(struct PlanificadorLPA));
+    if (plan == NULL) {
+        return NULL;
+    }
+    plan->maze = maze;
+    plan->inicio = inicio;
+    plan->fin = fin;
+    plan->celdas = n;
+    plan->g = malloc((size_t)n * sizeof(int));
+    plan->rhs = malloc((size_t)n * sizeof(int));
+    plan->cola = crearColaPrioridad(n);
+    if (plan->g == NULL || plan->rhs == NULL || plan->cola == NULL) {
+        liberarPlanificadorLPA(plan);
+        return NULL;
+    }
+
+    for (int i = 0; i < n; ++i) {
+        plan->g[i] = INF_LPA;
+        plan->rhs[i] = INF_LPA;
+    }
+    plan->rhs[inicio] = 0;
+    insertarCola(plan->cola, inicio, heuristicaLPA(plan, inicio));
+    return plan;
+}
+
+/*
+E: planificador, fila y columna de la celda, abrir (1 = camino de costo 1, 0 = muro).
+S: cambia la celda en el laberinto y marca sus alrededores para la proxima replanificacion;
+   retorna 0, o -1 si la celda esta fuera, es I o F.
+R: costo O(1): solo se revisan la celda y sus 4 vecinos; abrir no cambia celdas de terreno.
+*/
+int cambiarCeldaLPA(struct PlanificadorLPA* plan, int fila, int col, int abrir) {
+    if (plan == NULL || fila < 0 || fila >= plan->maze->rows || col < 0 || col >= plan->maze->cols) {
+        return -1;
+    }
+    int celda = fila * plan->maze->cols + col;
+    if (celda == plan->inicio || celda == plan->fin) {
+        return -1;
+    }
+    char nuevo = abrir ? '.' : WALL;
+    if (plan->maze->cells[fila][col] == nuevo || (abrir && plan->maze->cells[fila][col] != WALL)) {
+        return 0; //sin cambios
+    }
+    plan->maze->cells[fila][col] = nuevo;
+
+    //cambian las aristas de la celda con sus vecinos: se revisan ambos extremos
+    actualizarCeldaLPA(plan, celda);
+    actualizarVecinosLPA(plan, celda);
+    return 0;
+}
+
+/*
+E: planificador con g consistente y celda alcanzada distinta del inicio.
+S: vecino por el que se llega a la celda con el menor costo (g[vecino] = g[celda] - costo), o -1.
+R: celda dentro del laberinto.
+*/
+static int anteriorLPA(const struct PlanificadorLPA* plan, int celda) {
+    int objetivo = plan->g[celda] - costoCeldaLPA(plan, celda);
+    int vecinos[4];
+    int count = grid_neighbors(plan->maze, celda, vecinos);
+    for (int k = 0; k < count; ++k) {
+        if (plan->g[vecinos[k]] == objetivo) {
+            return vecinos[k];
+        }
+    }
+    return -1;
+}
+
+/*
+Repara el camino mas corto despues de los cambios de celdas.
+E: planificador.
+S: retorna Camino con indices de celda de inicio a fin (mismo valor que dijkstra_grid) o NULL si
+   no hay ruta/error; plan->expandidos queda con las celdas procesadas en esta llamada.
+R: solo se expanden las celdas afectadas por los cambios desde la llamada anterior.
+*/
+struct Camino* replanificarLPA(struct PlanificadorLPA* plan) {
+    if (plan == NULL) {
+        return NULL;
+    }
+    int* g = plan->g;
+    int* rhs = plan->rhs;
+    int fin = plan->fin;
+    plan->expandidos = 0;
+
+    while (plan->cola->tamano > 0) {
+        if (valorMinimo(plan->cola) > claveLPA(plan, fin) && g[fin] == rhs[fin]) {
+            break;
+        }
+        struct NodoPrioridad actual = extraerMinimo(plan->cola);
+        int u = actual.vertice;
+        if (g[u] == rhs[u]) {
+            continue; //ya es consistente
+        }
+        int clave = claveLPA(plan, u);
+        if (clave > actual.valor) {
+            insertarCola(plan->cola, u, clave); //la clave subio mientras estaba en la cola
+            continue;
+        }
+        plan->expandidos++;
+
+        if (g[u] > rhs[u]) {
+            //sobreconsistente: su distancia bajo y se propaga a los vecinos
+            g[u] = rhs[u];
+            actualizarVecinosLPA(plan, u);
+        } else {
+            //subconsistente: su distancia subio; se invalida y se recalcula junto con los vecinos
+            g[u] = INF_LPA;
+            actualizarCeldaLPA(plan, u);
+            actualizarVecinosLPA(plan, u);
+        }
+    }
+
+    if (g[fin] >= INF_LPA || g[fin] != rhs[fin]) {
+        return NULL;
+    }
+
+    //reconstruir de la meta al inicio bajando por g (cada paso reduce g en el costo de la celda);
+    //con terreno la cantidad de celdas no se deduce de g: primero se cuentan y luego se copian
+    int longitud = 1;
+    for (int actual = fin; actual != plan->inicio; ++longitud) {
+        actual = anteriorLPA(plan, actual);
+        if (actual == -1) {
+            return NULL;
+        }
+    }
+
+    struct Camino* camino = malloc(sizeof(struct Camino));
+    if (camino == NULL) {
+        return NULL;
+    }
+    camino->longitud = longitud;
+    camino->valorTotal = g[fin];
+    camino->expandidos = plan->expandidos;
+    camino->nodos = malloc((size_t)camino->longitud * sizeof(int));
+    if (camino->nodos == NULL) {
+        free(camino);
+        return NULL;
+    }
+
+    int actual = fin;
+    for (int i = camino->longitud - 1; i >= 0; --i) {
+        camino->nodos[i] = actual;
+        actual = anteriorLPA(plan, actual);
+    }
+    return camino;
+}
+
+/*
+E: planificador previamente creado.
+S: libera los arreglos, la cola y la estructura (el laberinto no se libera).
+R: plan puede ser NULL, no usar despues.
+*/
+void liberarPlanificadorLPA(struct PlanificadorLPA* plan) {
+    if (plan == NULL) {
+        return;
+    }
+    free(plan->g);
+    free(plan->rhs);
+    liberarColaPrioridad(plan->cola);
+    free(plan);
+}
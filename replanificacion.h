@@ -0,0 +1,27 @@
+#ifndef REPLANIFICACION_H
+#define REPLANIFICACION_H
+
+#include "laberinto.h"
+#include "dijkstra.h"
+
+//replanificacion incremental (Lifelong Planning A*) sobre la cuadricula implicita
+//el laberinto es el grafo: abrir o cerrar una celda solo cambia maze->cells en O(1), y la
+//siguiente replanificacion repara el camino reutilizando los valores de la busqueda anterior
+struct PlanificadorLPA {
+    struct Maze* maze; //laberinto que se modifica con cambiarCeldaLPA
+    int inicio; //celda de inicio (fila * cols + col)
+    int fin; //celda meta
+    int celdas; //rows * cols
+    int* g; //distancia conocida desde inicio (INF si no se conoce)
+    int* rhs; //distancia vista un paso adelante: min(g[vecino] + 1); g != rhs marca celdas a revisar
+    struct ColaPrioridad* cola; //celdas inconsistentes con clave min(g, rhs) + Manhattan a la meta
+    int expandidos; //celdas expandidas en la ultima replanificacion
+};
+
+// funciones del planificador incremental
+struct PlanificadorLPA* crearPlanificadorLPA(struct Maze* maze, int inicio, int fin);
+int cambiarCeldaLPA(struct PlanificadorLPA* plan, int fila, int col, int abrir);
+struct Camino* replanificarLPA(struct PlanificadorLPA* plan);
+void liberarPlanificadorLPA(struct PlanificadorLPA* plan);
+
+#endif
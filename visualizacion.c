@@ -1,9 +1,23 @@
+#define _POSIX_C_SOURCE 200809L
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <limits.h>
+#include <time.h>
+
+#ifndef _WIN32
+#include <sys/ioctl.h>
+#include <unistd.h>
+#endif
 
 #include "visualizacion.h"
+#include "escritor.h"
+
+//la animacion de print_path_steps muestra a lo sumo ANIMACION_FPS cuadros por segundo; en
+//recorridos largos cada cuadro avanza varios pasos para no pasar de ANIMACION_SEGUNDOS
+#define ANIMACION_FPS 30
+#define ANIMACION_SEGUNDOS 10
 
 /*
 E: arreglo parent, indices start/goal, numero de vertices y arreglo de salida.
@@ -43,32 +57,44 @@ int build_path_sequence(const int *parent, int start, int goal, int vertices, in
 }
 
 /*
-E: paso actual, nodo procesado, arreglos de valores y visitados, numero de nodos.
-S: imprime el estado actual de las distancias y visitados en Dijkstra.
-R: arreglos validos de tamano n.
+E: indice del nodo, su valor (INT_MAX / 8 o mas = infinito), si esta visitado y si es el actual.
+S: imprime una fila del estado de Dijkstra.
+R: ninguna.
 */
-void print_estado_dijkstra(int paso, int actual, const int *val, const int *visitado, int n) {
-    printf("\nPaso %d: procesamos el nodo %d\n", paso, actual);
+static void print_fila_estado_dijkstra(int i, int valor, int visitado, int esActual) {
+    char dist[16];
+    if (valor >= INT_MAX / 8) {
+        snprintf(dist, sizeof(dist), "inf");
+    } else {
+        snprintf(dist, sizeof(dist), "%d", valor);
+    }
 
-    for (int i = 0; i < n; ++i) {
-        char dist[16];
-        if (val[i] >= INT_MAX / 8) {
-            snprintf(dist, sizeof(dist), "inf");
-        } else {
-            snprintf(dist, sizeof(dist), "%d", val[i]);
-        }
+    const char* estado;
+    if (visitado) {
+        estado = "visitado";
+    } else if (valor >= INT_MAX / 8) {
+        estado = "sin ruta";
+    } else {
+        estado = "pendiente";
+    }
 
-        const char* estado;
-        if (visitado[i]) {
-            estado = "visitado";
-        } else if (val[i] >= INT_MAX / 8) {
-            estado = "sin ruta";
-        } else {
-            estado = "pendiente";
-        }
+    const char* marca = esActual ? " <- actual" : "";
+    printf("  %2d) dist=%-7s estado=%s%s\n", i, dist, estado, marca);
+}
+
+/*
+E: contexto (no se usa) y el estado que Dijkstra entrega despues de cada expansion.
+S: imprime las distancias y visitados de todos los nodos leyendo el espacio de busqueda; sirve como ObservadorDijkstra.
+R: espacio de la consulta en curso, n vertices.
+*/
+void observar_estado_dijkstra(void* contexto, int paso, int actual, const struct EspacioBusqueda *espacio, int n) {
+    (void)contexto;
+    printf("\nPaso %d: procesamos el nodo %d\n", paso, actual);
 
-        const char* marca = (i == actual) ? " <- actual" : "";
-        printf("  %2d) dist=%-7s estado=%s%s\n", i, dist, estado, marca);
+    for (int i = 0; i < n; ++i) {
+        //un vertice sin valor en esta consulta sigue en infinito
+        int valor = espacioTieneValor(espacio, i) ? espacio->val[i] : INT_MAX / 4;
+        print_fila_estado_dijkstra(i, valor, espacioVisitado(espacio, i), i == actual);
     }
 }
 
@@ -117,7 +143,8 @@ void print_path_on_maze(const struct Maze *maze, const struct Grafo *graph, cons
     }
 
     //expandir el camino para incluir celdas intermedias
-    struct Point *expandedPath = calloc(MAX_ROWS * MAX_COLS, sizeof(struct Point));
+    //cada nodo aporta a lo sumo 2 celdas (intermedia + destino)
+    struct Point *expandedPath = calloc((size_t)len * 2, sizeof(struct Point));
     if (expandedPath == NULL) {
         printf("No se pudo reservar memoria para expandir el camino.\n");
         free(path);
@@ -125,22 +152,39 @@ void print_path_on_maze(const struct Maze *maze, const struct Grafo *graph, cons
     }
 
     int expandedLen = expand_path_with_intermediate_cells(maze, graph, path, len, expandedPath);
+    print_points_on_maze(maze, expandedPath, expandedLen);
 
-    char display[MAX_ROWS][MAX_COLS + 1];
+    free(path);
+    free(expandedPath);
+}
+
+/*
+E: laberinto y arreglo de celdas del camino con su cantidad.
+S: imprime laberinto con las celdas marcadas con 'o', preservando I y F.
+R: celdas consecutivas del camino ya expandidas.
+.*/
+void print_points_on_maze(const struct Maze *maze, const struct Point *points, int count) {
+    //copia de trabajo de las celdas en un solo bloque de rows x cols
+    size_t cols = (size_t)maze->cols;
+    char *display = malloc((size_t)maze->rows * cols);
+    if (display == NULL) {
+        printf("No se pudo reservar memoria para mostrar el laberinto.\n");
+        return;
+    }
     for (int r = 0; r < maze->rows; ++r) {
-        strcpy(display[r], maze->cells[r]);
+        memcpy(display + r * cols, maze->cells[r], cols);
     }
 
     //marcar todas las celdas del camino expandido con 'o', preservando I y F
-    for (int i = 0; i < expandedLen; ++i) {
-        struct Point p = expandedPath[i];
+    for (int i = 0; i < count; ++i) {
+        struct Point p = points[i];
 
         //validar coordenadas
         if (p.row < 0 || p.row >= maze->rows || p.col < 0 || p.col >= maze->cols) {
             continue;
         }
 
-        char *cell = &display[p.row][p.col];
+        char *cell = &display[p.row * cols + p.col];
 
         //preservar I y F, marcar todo lo demas con 'o'
         if (maze->cells[p.row][p.col] != START && maze->cells[p.row][p.col] != END) {
@@ -150,12 +194,37 @@ void print_path_on_maze(const struct Maze *maze, const struct Grafo *graph, cons
 
     printf("\n=== Camino final (marcado con 'o') ===\n");
     for (int r = 0; r < maze->rows; ++r) {
-        printf("%s\n", display[r]);
+        printf("%.*s\n", maze->cols, display + r * cols);
     }
     printf("\n");
+    free(display);
+}
 
-    free(path);
-    free(expandedPath);
+/*
+E: laberinto y camino de indices de celda (fila * cols + col) con su longitud.
+S: convierte los indices a coordenadas e imprime el camino sobre el laberinto.
+R: celdas dentro del laberinto; camino de busquedas sobre la cuadricula.
+.*/
+void print_cell_path_on_maze(const struct Maze *maze, const int *cells, int count) {
+    if (cells == NULL || count <= 0) {
+        printf("No hay camino entre I y F.\n");
+        return;
+    }
+
+    struct Point *points = calloc(count, sizeof(struct Point));
+    if (points == NULL) {
+        printf("No se pudo reservar memoria para mostrar el laberinto.\n");
+        return;
+    }
+
+    //en la cuadricula cada paso ya es una celda adyacente, no hace falta expandir
+    for (int i = 0; i < count; ++i) {
+        points[i].row = cells[i] / maze->cols;
+        points[i].col = cells[i] % maze->cols;
+    }
+
+    print_points_on_maze(maze, points, count);
+    free(points);
 }
 
 /*
@@ -236,10 +305,104 @@ int expand_path_with_intermediate_cells(const struct Maze *maze, const struct Gr
     return expandedLen;
 }
 
+/*
+E: filas y columnas del laberinto.
+S: retorna 1 si la salida es una terminal donde cabe el laberinto (la animacion mueve el cursor
+   hacia arriba y no puede alcanzar lineas que ya salieron de la pantalla), 0 si no.
+R: ninguna.
+.*/
+static int terminal_admite_animacion(int rows, int cols) {
+#ifndef _WIN32
+    if (!isatty(STDOUT_FILENO)) {
+        return 0;
+    }
+    struct winsize ventana;
+    if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &ventana) == 0 && ventana.ws_row > 0 &&
+        (rows + 2 > ventana.ws_row || cols > ventana.ws_col)) {
+        return 0;
+    }
+    return 1;
+#else
+    (void)rows;
+    (void)cols;
+    return 0; //la consola de Windows no siempre interpreta las secuencias ANSI
+#endif
+}
+
+/*
+E: escritor, filas del laberinto, celda y caracter.
+S: escribe el caracter en la celda moviendo el cursor desde la linea de estado y regresa a ella.
+R: el cursor esta en la linea de estado, justo debajo de la ultima fila del laberinto.
+.*/
+static void dibujar_celda(struct Escritor *escritor, int rows, struct Point p, char c) {
+    int arriba = rows - p.row;
+    escribirTexto(escritor, "\r\x1b[");
+    escribirEntero(escritor, arriba);
+    escribirTexto(escritor, "A\x1b[");
+    escribirEntero(escritor, p.col + 1);
+    escribirCaracter(escritor, 'G');
+    escribirCaracter(escritor, c);
+    escribirTexto(escritor, "\x1b[");
+    escribirEntero(escritor, arriba);
+    escribirCaracter(escritor, 'B');
+}
+
+/*
+E: escritor, paso actual y total de pasos.
+S: reescribe la linea de estado "Paso k de N" y borra lo que sobre de la anterior.
+R: el cursor esta en la linea de estado.
+.*/
+static void dibujar_estado(struct Escritor *escritor, int paso, int total) {
+    escribirTexto(escritor, "\rPaso ");
+    escribirEntero(escritor, paso);
+    escribirTexto(escritor, " de ");
+    escribirEntero(escritor, total);
+    escribirTexto(escritor, "\x1b[K");
+}
+
+/*
+E: laberinto, celdas del recorrido y su cantidad.
+S: imprime un paso por linea con su numero y su celda (fila, columna), en O(pasos).
+R: se usa cuando la salida no admite la animacion (archivo, tuberia o terminal pequena).
+.*/
+static void listar_pasos(const struct Maze *maze, const struct Point *celdas, int total) {
+    fflush(stdout);
+    struct Escritor *escritor = crearEscritor(stdout, 0);
+    if (escritor == NULL) {
+        printf("No se pudo reservar memoria para mostrar el recorrido.\n");
+        return;
+    }
+
+    escribirTexto(escritor, "\n=== Recorrido paso a paso (fila, columna) ===\n");
+    for (int step = 0; step < total; ++step) {
+        struct Point p = celdas[step];
+        //las mismas celdas que se saltaria la animacion (fuera del laberinto o muro)
+        if (p.row < 0 || p.row >= maze->rows || p.col < 0 || p.col >= maze->cols || maze->cells[p.row][p.col] == WALL) {
+            continue;
+        }
+        escribirTexto(escritor, "Paso ");
+        escribirEntero(escritor, step + 1);
+        escribirTexto(escritor, " de ");
+        escribirEntero(escritor, total);
+        escribirTexto(escritor, ": (");
+        escribirEntero(escritor, p.row);
+        escribirTexto(escritor, ", ");
+        escribirEntero(escritor, p.col);
+        escribirTexto(escritor, ")\n");
+    }
+    escribirTexto(escritor, "=== Recorrido completado: ");
+    escribirEntero(escritor, total);
+    escribirTexto(escritor, " pasos totales ===\n\n");
+    liberarEscritor(escritor);
+}
+
 /*
 E: laberinto, grafo, arreglo parent y nodos start/goal.
-S: imprime frame a frame el recorrido usando 'A' para la posicion actual y 'o' para visitados.
-R: parent describe una ruta valida; el grafo tiene mapeo indexToCoord; buffers dentro de limites.
+S: dibuja el laberinto una vez y anima el recorrido reescribiendo solo las celdas que cambian
+   ('A' para la posicion actual y 'o' para visitados) con movimientos de cursor ANSI.
+R: parent describe una ruta valida; el grafo tiene mapeo indexToCoord; salida a una terminal donde
+   quepa el laberinto (si no, se listan los pasos como texto plano); a lo sumo ANIMACION_FPS cuadros
+   por segundo, con varios pasos por cuadro si el recorrido duraria mas de ANIMACION_SEGUNDOS.
 .*/
 void print_path_steps(const struct Maze *maze, const struct Grafo *graph, const int *parent, int start, int goal) {
     int *path = calloc(graph->vertices, sizeof(int));
@@ -256,7 +419,8 @@ void print_path_steps(const struct Maze *maze, const struct Grafo *graph, const
     }
 
     //expandir el camino para incluir todas las celdas intermedias
-    struct Point *expandedPath = calloc(MAX_ROWS * MAX_COLS, sizeof(struct Point));
+    //cada nodo aporta a lo sumo 2 celdas (intermedia + destino)
+    struct Point *expandedPath = calloc((size_t)len * 2, sizeof(struct Point));
     if (expandedPath == NULL) {
         printf("No se pudo reservar memoria para expandir el camino.\n");
         free(path);
@@ -264,58 +428,80 @@ void print_path_steps(const struct Maze *maze, const struct Grafo *graph, const
     }
 
     int expandedLen = expand_path_with_intermediate_cells(maze, graph, path, len, expandedPath);
+    free(path);
     if (expandedLen <= 0) {
         printf("Error: No se pudo expandir el camino.\n");
         printf("Longitud del camino original: %d nodos\n", len);
-        free(path);
         free(expandedPath);
         return;
     }
 
-    printf("\n=== Recorrido paso a paso (A = posicion actual) ===\n");
-    for (int step = 0; step < expandedLen; ++step) {
-        char frame[MAX_ROWS][MAX_COLS + 1];
-        for (int r = 0; r < maze->rows; ++r) {
-            strcpy(frame[r], maze->cells[r]);
-        }
-
-        //marcar el progreso: 'o' para lo recorrido, 'A' para la celda actual
-        for (int k = 0; k <= step; ++k) {
-            struct Point p = expandedPath[k];
+    //sin terminal donde quepa el laberinto no se puede mover el cursor: listar los pasos
+    if (!terminal_admite_animacion(maze->rows, maze->cols)) {
+        listar_pasos(maze, expandedPath, expandedLen);
+        free(expandedPath);
+        return;
+    }
 
-            //validar que las coordenadas esten dentro de los limites
-            if (p.row < 0 || p.row >= maze->rows || p.col < 0 || p.col >= maze->cols) {
-                continue;
-            }
+    //todo pasa por un solo buffer; cada cuadro se entrega a la terminal de una vez
+    fflush(stdout);
+    struct Escritor *escritor = crearEscritor(stdout, 0);
+    if (escritor == NULL) {
+        printf("No se pudo reservar memoria para animar el recorrido.\n");
+        free(expandedPath);
+        return;
+    }
 
-            char *cell = &frame[p.row][p.col];
+    //el laberinto se dibuja completo una sola vez; debajo queda la linea de estado
+    escribirTexto(escritor, "\n=== Recorrido paso a paso (A = posicion actual) ===\n");
+    for (int r = 0; r < maze->rows; ++r) {
+        escribirBytes(escritor, maze->cells[r], (size_t)maze->cols);
+        escribirCaracter(escritor, '\n');
+    }
 
-            //verificar que la celda no sea una pared antes de modificarla
-            if (maze->cells[p.row][p.col] == WALL) {
+    int pasosPorCuadro = (expandedLen + ANIMACION_FPS * ANIMACION_SEGUNDOS - 1) / (ANIMACION_FPS * ANIMACION_SEGUNDOS);
+    int previo = -1; //ultimo paso dibujado con 'A'
+    struct timespec siguiente;
+    clock_gettime(CLOCK_MONOTONIC, &siguiente);
+
+    for (int step = 0; step < expandedLen; ) {
+        //aplicar los pasos del cuadro: la celda anterior pasa de 'A' a 'o' (I y F se conservan)
+        int fin = step + pasosPorCuadro < expandedLen ? step + pasosPorCuadro : expandedLen;
+        for (; step < fin; ++step) {
+            struct Point p = expandedPath[step];
+            if (p.row < 0 || p.row >= maze->rows || p.col < 0 || p.col >= maze->cols || maze->cells[p.row][p.col] == WALL) {
                 continue;
             }
-
-            if (k == step) {
-                //mostrar la posicion actual con 'A'
-                *cell = 'A';
-            } else {
-                //marcar las posiciones ya visitadas con 'o', preservando I y F
-                if (maze->cells[p.row][p.col] != START && maze->cells[p.row][p.col] != END) {
-                    *cell = 'o';
-                }
+            if (previo != -1) {
+                struct Point q = expandedPath[previo];
+                char anterior = maze->cells[q.row][q.col];
+                dibujar_celda(escritor, maze->rows, q, (anterior == START || anterior == END) ? anterior : 'o');
             }
+            dibujar_celda(escritor, maze->rows, p, 'A');
+            previo = step;
         }
-
-        printf("Paso %d de %d:\n", step + 1, expandedLen);
-        for (int r = 0; r < maze->rows; ++r) {
-            printf("%s\n", frame[r]);
+        dibujar_estado(escritor, step, expandedLen);
+        vaciarEscritor(escritor);
+
+        //limitar la frecuencia de cuadros: esperar hasta el inicio del siguiente
+        siguiente.tv_nsec += 1000000000L / ANIMACION_FPS;
+        if (siguiente.tv_nsec >= 1000000000L) {
+            siguiente.tv_sec++;
+            siguiente.tv_nsec -= 1000000000L;
+        }
+        struct timespec ahora;
+        clock_gettime(CLOCK_MONOTONIC, &ahora);
+        long long espera = (long long)(siguiente.tv_sec - ahora.tv_sec) * 1000000000LL + (siguiente.tv_nsec - ahora.tv_nsec);
+        if (step < expandedLen && espera > 0) {
+            struct timespec pausa = {(time_t)(espera / 1000000000LL), (long)(espera % 1000000000LL)};
+            nanosleep(&pausa, NULL);
         }
-        printf("\n");
     }
 
-    printf("=== Animacion completada: %d pasos totales ===\n\n", expandedLen);
-
-    free(path);
+    escribirTexto(escritor, "\n=== Animacion completada: ");
+    escribirEntero(escritor, expandedLen);
+    escribirTexto(escritor, " pasos totales ===\n\n");
+    liberarEscritor(escritor);
     free(expandedPath);
 }
 
@@ -360,9 +546,9 @@ void print_path_indices(const int *parent, int start, int goal, int vertices) {
 }
 
 /*
-E: grafo con matriz de adyacencia.
+E: grafo con adyacencia comprimida.
 S: imprime matriz completa o primeras 30 filas/cols.
-R: matriz cuadrada de tamano vertices.
+R: grafo valido con vertices > 0.
 .*/
 void print_adjacency_matrix(const struct Grafo *graph) {
     int limit = graph->vertices;
@@ -375,7 +561,7 @@ void print_adjacency_matrix(const struct Grafo *graph) {
 
     for (int i = 0; i < limit; ++i) {
         for (int j = 0; j < limit; ++j) {
-            int val = graph->peso[i][j] > 0 ? 1 : 0;
+            int val = pesoArista(graph, i, j) > 0 ? 1 : 0;
             printf("%d ", val);
         }
         printf("\n");